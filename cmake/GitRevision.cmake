@@ -0,0 +1,32 @@
+# Write the git revision of the source tree to a header, run at build time by
+# the GitRevision target. The header is rewritten only if the revision has
+# changed, so that dependent sources are not rebuilt otherwise.
+#
+# Input variables: GIT_EXECUTABLE, SOURCE_DIR, OUTPUT_FILE
+
+set(HRM_GIT_REVISION "unknown")
+if(GIT_EXECUTABLE)
+    execute_process(COMMAND ${GIT_EXECUTABLE} describe --always --dirty
+                    WORKING_DIRECTORY ${SOURCE_DIR}
+                    OUTPUT_VARIABLE GIT_DESCRIBE_OUTPUT
+                    OUTPUT_STRIP_TRAILING_WHITESPACE
+                    ERROR_QUIET)
+    if(GIT_DESCRIBE_OUTPUT)
+        set(HRM_GIT_REVISION ${GIT_DESCRIBE_OUTPUT})
+    endif()
+endif()
+
+set(HEADER_CONTENT "/** \\author Sipu Ruan */
+
+#pragma once
+
+#define HRM_GIT_REVISION \"${HRM_GIT_REVISION}\"
+")
+
+set(OLD_CONTENT "")
+if(EXISTS ${OUTPUT_FILE})
+    file(READ ${OUTPUT_FILE} OLD_CONTENT)
+endif()
+if(NOT "${OLD_CONTENT}" STREQUAL "${HEADER_CONTENT}")
+    file(WRITE ${OUTPUT_FILE} "${HEADER_CONTENT}")
+endif()
@@ -0,0 +1,36 @@
+/** \author Sipu Ruan */
+
+#include "hrm/config.h"
+#include "hrm/util/Parse2dBinaryFile.h"
+
+#include <filesystem>
+#include <iostream>
+
+/** \brief Convert .csv files of scenes, robots and SO(3) samples into the
+ * binary format. Without arguments, all the .csv files in the resources
+ * folder are converted */
+int main(int argc, char** argv) {
+    std::vector<std::string> filenames;
+    for (int i = 1; i < argc; ++i) {
+        filenames.push_back(argv[i]);
+    }
+
+    if (filenames.empty()) {
+        for (const std::string folder : {"/2D", "/3D", "/SO3_sequence"}) {
+            for (const auto& entry : std::filesystem::directory_iterator(
+                     RESOURCES_PATH + folder)) {
+                if (entry.path().extension() == ".csv") {
+                    filenames.push_back(entry.path().string());
+                }
+            }
+        }
+    }
+
+    for (const auto& filename : filenames) {
+        hrm::convertCsvToBinary(filename);
+        std::cout << "Converted: " << filename << " -> "
+                  << hrm::getBinaryFilename(filename) << std::endl;
+    }
+
+    return 0;
+}
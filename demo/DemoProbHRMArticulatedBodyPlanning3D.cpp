@@ -55,6 +55,7 @@ int main() {
     hrm::displayPlanningTimeInfo(res.planningTime);
     hrm::displayGraphInfo(res.graphStructure);
     hrm::displayPathInfo(res.solutionPath);
+    hrm::displayOperationCountInfo(res.operationCount);
 
     hrm::storeGraphInfo(res.graphStructure, "prob_hrm_3D");
     hrm::storePathInfo(res.solutionPath, "prob_hrm_3D");
@@ -0,0 +1,172 @@
+"""
+@author: Sipu Ruan
+
+Compare two benchmark result files in the common JSON schema written by the
+benchmark programs, and flag statistically significant slowdowns.
+
+Usage:
+    python compare_benchmarks.py baseline.json candidate.json
+        [--metrics PLAN_TIME BUILD_TIME] [--alpha 0.05] [--threshold 0.05]
+
+For each benchmark case and metric present in both files, the one-sided
+Mann-Whitney U test checks whether the candidate trials are larger than the
+baseline trials. A metric is flagged as regression when the p-value is below
+alpha and the median increases by more than the threshold ratio. The exit code
+is 1 if any regression is found, so the tool can gate upgrades in scripts.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+
+def load_benchmark(filename):
+    with open(filename) as f:
+        data = json.load(f)
+
+    if data.get("schema") != "hrm_benchmark":
+        raise ValueError(filename + " is not in the benchmark schema")
+
+    cases = {}
+    for case in data["cases"]:
+        metrics = {}
+        for j, name in enumerate(case["metrics"]):
+            metrics[name] = [trial[j] for trial in case["trials"]
+                             if trial[j] is not None]
+        cases[case["name"]] = metrics
+
+    return data, cases
+
+
+def median(values):
+    s = sorted(values)
+    n = len(s)
+    return 0.5 * (s[(n - 1) // 2] + s[n // 2])
+
+
+def mann_whitney_greater(x, y):
+    """
+    One-sided Mann-Whitney U test with normal approximation and tie
+    correction. Returns the p-value of the hypothesis that samples of y are
+    stochastically larger than samples of x.
+    """
+    n1 = len(x)
+    n2 = len(y)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    # Average ranks of the pooled samples
+    pooled = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+    ranks = [0.0] * len(pooled)
+    tie_term = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = 0.5 * (i + j) + 1.0
+        t = j - i + 1
+        tie_term += t ** 3 - t
+        i = j + 1
+
+    rank_sum_y = sum(r for r, (_, group) in zip(ranks, pooled) if group == 1)
+    u = rank_sum_y - n2 * (n2 + 1) / 2.0
+
+    n = n1 + n2
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1))) \
+        if n > 1 else 0.0
+    if variance <= 0.0:
+        return 1.0
+
+    # Continuity correction
+    z = (u - mean - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def is_time_metric(name):
+    return name.endswith("_TIME") or name.startswith("TIME")
+
+
+def compare_benchmarks(baseline_file, candidate_file, metrics=None,
+                       alpha=0.05, threshold=0.05):
+    baseline_data, baseline = load_benchmark(baseline_file)
+    candidate_data, candidate = load_benchmark(candidate_file)
+
+    for key in ["git_revision", "compiler", "compiler_flags", "cpu_model"]:
+        b = baseline_data["metadata"].get(key)
+        c = candidate_data["metadata"].get(key)
+        print("{:<16} {} -> {}".format(key, b, c))
+    if baseline_data["parameters"] != candidate_data["parameters"]:
+        print("Warning: planner parameters differ between the files")
+    print()
+
+    print("{:<40} {:<26} {:>12} {:>12} {:>8} {:>9}  {}".format(
+        "CASE", "METRIC", "BASE_MEDIAN", "NEW_MEDIAN", "RATIO", "P_VALUE",
+        "STATUS"))
+
+    regressions = []
+    for case_name, base_metrics in baseline.items():
+        if case_name not in candidate:
+            print("{:<40} missing in candidate".format(case_name))
+            continue
+
+        for metric, base_values in base_metrics.items():
+            if metrics is not None and metric not in metrics:
+                continue
+            if metrics is None and not is_time_metric(metric):
+                continue
+
+            new_values = candidate[case_name].get(metric, [])
+            if not base_values or not new_values:
+                continue
+
+            base_median = median(base_values)
+            new_median = median(new_values)
+            if base_median == 0.0 and new_median == 0.0:
+                # Phase not recorded by the planner
+                continue
+
+            ratio = new_median / base_median if base_median > 0 else \
+                float("inf") if new_median > 0 else 1.0
+            p_value = mann_whitney_greater(base_values, new_values)
+
+            status = ""
+            if p_value < alpha and ratio > 1.0 + threshold:
+                status = "REGRESSION"
+                regressions.append((case_name, metric))
+            elif mann_whitney_greater(new_values, base_values) < alpha and \
+                    ratio < 1.0 - threshold:
+                status = "improved"
+
+            print("{:<40} {:<26} {:>12.6g} {:>12.6g} {:>8.3f} {:>9.4f}  {}"
+                  .format(case_name[:40], metric, base_median, new_median,
+                          ratio, p_value, status))
+
+    print()
+    if regressions:
+        print("{} significant slowdown(s) found".format(len(regressions)))
+    else:
+        print("No significant slowdown found")
+
+    return regressions
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Compare benchmark results and flag slowdowns")
+    parser.add_argument("baseline", help="Baseline result file (JSON)")
+    parser.add_argument("candidate", help="Candidate result file (JSON)")
+    parser.add_argument("--metrics", nargs="+", default=None,
+                        help="Metrics to compare, default all time metrics")
+    parser.add_argument("--alpha", type=float, default=0.05,
+                        help="Significance level of the test")
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="Minimum relative increase of the median")
+    args = parser.parse_args()
+
+    found = compare_benchmarks(args.baseline, args.candidate, args.metrics,
+                               args.alpha, args.threshold)
+    sys.exit(1 if found else 0)
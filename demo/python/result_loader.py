@@ -2,10 +2,30 @@
 @author: Sipu Ruan
 """
 
+import os
+
 import pandas as pd
 import numpy as np
 
 
+def load_data_file(filename_base):
+    # Binary dump (dense matrix of doubles or 32-bit indices) if it is up to date with the .csv file,
+    # otherwise .csv file
+    binary_file = filename_base + ".bin"
+    csv_file = filename_base + ".csv"
+    if os.path.exists(binary_file) and (not os.path.exists(csv_file) or
+                                        os.path.getmtime(binary_file) >= os.path.getmtime(csv_file)):
+        with open(binary_file, "rb") as f:
+            if f.read(8) != b"HRMMAT01":
+                raise ValueError("Invalid binary file " + binary_file)
+            num_row, num_col, entry_type = (int(n) for n in np.fromfile(f, dtype=np.uint64, count=3))
+            dtype = np.float64 if entry_type == 0 else np.uint32
+            data = np.fromfile(f, dtype=dtype, count=num_row * num_col)
+        return data.reshape(num_row, num_col).astype(np.float64)
+
+    return pd.read_csv(csv_file, header=None, dtype=np.float64).values
+
+
 def load_planning_scene(dim, config_path):
     # Planning environment
     arena_config = pd.read_csv(config_path + "arena_config_" + dim + ".csv", header=None, dtype=np.float64).values
@@ -32,12 +52,14 @@ def load_results(suffix, result_path):
 
         print('No discrete points on obstacles will be shown.')
 
-    vtx = pd.read_csv(result_path + "vertex_" + suffix + ".csv", header=None, dtype=np.float64).values
-    edge = pd.read_csv(result_path + "edge_" + suffix + ".csv", header=None, dtype=np.float64).values
+    vtx = load_data_file(result_path + "vertex_" + suffix)
+    edge = load_data_file(result_path + "edge_" + suffix)
 
     try:
-        path = pd.read_csv(result_path + "interpolated_path_" + suffix + ".csv", header=None, dtype=np.float64).values
+        path = load_data_file(result_path + "interpolated_path_" + suffix)
+        if path.size == 0:
+            raise ValueError("Empty interpolated path")
     except:
-        path = pd.read_csv(result_path + "solution_path_" + suffix + ".csv", header=None, dtype=np.float64).values
+        path = load_data_file(result_path + "solution_path_" + suffix)
 
     return x_origin, x_mink, cf_seg, vtx, edge, path
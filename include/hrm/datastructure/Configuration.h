@@ -0,0 +1,58 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "DataType.h"
+
+#include <Eigen/StdVector>
+#include <vector>
+
+namespace hrm {
+
+/** \brief Configuration with dimension known at compile time, Eigen::Dynamic
+ * for run-time dimension */
+template <int Dim>
+using Configuration = Eigen::Matrix<Coordinate, Dim, 1>;
+
+/** \brief SE(2) configuration: {x, y, theta} */
+using ConfigurationSE2 = Configuration<3>;
+
+/** \brief SE(3) configuration: {x, y, z, qw, qx, qy, qz} */
+using ConfigurationSE3 = Configuration<7>;
+
+/** \brief SE(3) x R^n configuration for articulated robot with NumJoint
+ * joints: {x, y, z, qw, qx, qy, qz, joint_1, ..., joint_n} */
+template <int NumJoint>
+using ConfigurationSE3Rn = Configuration<(NumJoint == Eigen::Dynamic)
+                                             ? Eigen::Dynamic
+                                             : 7 + NumJoint>;
+
+/** \brief List of configurations, aligned for fixed-size vectorizable types */
+template <int Dim>
+using ConfigurationList = std::vector<
+    Configuration<Dim>, Eigen::aligned_allocator<Configuration<Dim>>>;
+
+/** \brief Convert std::vector to configuration type, only the first Dim
+ * entries are taken for compile-time dimension
+ * \param v Configuration stored in std::vector
+ * \return Configuration type */
+template <int Dim>
+Configuration<Dim> toConfiguration(const std::vector<Coordinate>& v) {
+    if constexpr (Dim == Eigen::Dynamic) {
+        return Eigen::Map<const Configuration<Dim>>(
+            v.data(), static_cast<Eigen::Index>(v.size()));
+    } else {
+        return Eigen::Map<const Configuration<Dim>>(v.data());
+    }
+}
+
+/** \brief Convert configuration type to std::vector
+ * \param config Configuration type
+ * \return Configuration stored in std::vector */
+template <int Dim>
+std::vector<Coordinate> toVector(const Configuration<Dim>& config) {
+    return std::vector<Coordinate>(config.data(),
+                                   config.data() + config.size());
+}
+
+}  // namespace hrm
@@ -22,20 +22,34 @@ void FreeSpaceComputator<RobotType, ObjectType>::setup(
     lowBound_ = lowBound;
     upBound_ = upBound;
 
+    initIntersectionInterval(intersect_, numLine);
+}
+
+template <typename RobotType, typename ObjectType>
+void FreeSpaceComputator<RobotType, ObjectType>::initWorkspace(
+    SweepLineWorkspace& workspace, const unsigned int numLine) const {
+    initIntersectionInterval(workspace.intersect, numLine);
+    workspace.numRayCast = 0;
+    workspace.numTriangleTest = 0;
+}
+
+template <typename RobotType, typename ObjectType>
+void FreeSpaceComputator<RobotType, ObjectType>::initIntersectionInterval(
+    IntersectionInterval& intersect, const unsigned int numLine) const {
     const auto numArena =
         static_cast<Eigen::Index>((1 + robot_.getNumLinks()) * arena_.size());
     const auto numObstacle = static_cast<Eigen::Index>(
         (1 + robot_.getNumLinks()) * obstacle_.size());
 
     // Initialize sweep lines
-    intersect_.arenaLow.resize(numLine,
-                               std::vector<Coordinate>(numArena, lowBound));
-    intersect_.arenaUpp.resize(numLine,
-                               std::vector<Coordinate>(numArena, upBound));
-    intersect_.obstacleLow.resize(numLine,
-                                  std::vector<Coordinate>(numObstacle, NAN));
-    intersect_.obstacleUpp.resize(numLine,
-                                  std::vector<Coordinate>(numObstacle, NAN));
+    intersect.arenaLow.resize(numLine,
+                              std::vector<Coordinate>(numArena, lowBound_));
+    intersect.arenaUpp.resize(numLine,
+                              std::vector<Coordinate>(numArena, upBound_));
+    intersect.obstacleLow.resize(numLine,
+                                 std::vector<Coordinate>(numObstacle, NAN));
+    intersect.obstacleUpp.resize(numLine,
+                                 std::vector<Coordinate>(numObstacle, NAN));
 }
 
 template <typename RobotType, typename ObjectType>
@@ -62,19 +76,26 @@ void FreeSpaceComputator<RobotType, ObjectType>::computeCSpaceBoundary() {
 template <typename RobotType, typename ObjectType>
 void FreeSpaceComputator<RobotType, ObjectType>::computeFreeSegment(
     const std::vector<Coordinate>& ty) {
-    segment_.xL.clear();
-    segment_.xU.clear();
-    segment_.xM.clear();
-    std::vector<Interval> interval[ty.size()];
+    computeFreeSegment(ty, intersect_, segment_);
+}
+
+template <typename RobotType, typename ObjectType>
+void FreeSpaceComputator<RobotType, ObjectType>::computeFreeSegment(
+    const std::vector<Coordinate>& ty, const IntersectionInterval& intersect,
+    FreeSegment2D& segment) const {
+    segment.xL.clear();
+    segment.xU.clear();
+    segment.xM.clear();
+    std::vector<std::vector<Interval>> interval(ty.size());
 
     // y-coord
-    segment_.ty = ty;
+    segment.ty = ty;
 
     // Collision-free line segment for each ty
     for (Index i = 0; i < ty.size(); ++i) {
         // Construct intervals at each sweep line
         const auto lineIdx = static_cast<Eigen::Index>(i);
-        interval[i] = computeSweepLineFreeSegment(lineIdx);
+        interval[i] = computeSweepLineFreeSegment(intersect, lineIdx);
 
         // x-(z-)coords
         std::vector<Coordinate> xL;
@@ -86,37 +107,37 @@ void FreeSpaceComputator<RobotType, ObjectType>::computeFreeSegment(
             xU.push_back(interval[i][j].e());
             xM.push_back((interval[i][j].s() + interval[i][j].e()) / 2.0);
         }
-        segment_.xL.push_back(xL);
-        segment_.xU.push_back(xU);
-        segment_.xM.push_back(xM);
+        segment.xL.push_back(xL);
+        segment.xU.push_back(xU);
+        segment.xM.push_back(xM);
     }
 
     // Enhanced process to generate more valid vertices within free line
     // segement
-    enhanceFreeSegment();
+    enhanceFreeSegment(segment);
 }
 
 template <typename RobotType, typename ObjectType>
 std::vector<Interval>
 FreeSpaceComputator<RobotType, ObjectType>::computeSweepLineFreeSegment(
-    const Eigen::Index& lineIdx) {
+    const IntersectionInterval& intersect, const Eigen::Index& lineIdx) const {
     // Construct intervals of the segment_ sweep line
     std::vector<Interval> obsSegment;
     std::vector<Interval> arenaSegment;
 
     // Remove NaN terms
-    for (auto j = 0; j < intersect_.arenaLow.at(lineIdx).size(); ++j) {
-        if (!std::isnan(intersect_.arenaLow.at(lineIdx).at(j)) &&
-            !std::isnan(intersect_.arenaUpp.at(lineIdx).at(j))) {
-            arenaSegment.push_back({intersect_.arenaLow.at(lineIdx).at(j),
-                                    intersect_.arenaUpp.at(lineIdx).at(j)});
+    for (auto j = 0; j < intersect.arenaLow.at(lineIdx).size(); ++j) {
+        if (!std::isnan(intersect.arenaLow.at(lineIdx).at(j)) &&
+            !std::isnan(intersect.arenaUpp.at(lineIdx).at(j))) {
+            arenaSegment.push_back({intersect.arenaLow.at(lineIdx).at(j),
+                                    intersect.arenaUpp.at(lineIdx).at(j)});
         }
     }
-    for (auto j = 0; j < intersect_.obstacleLow.at(lineIdx).size(); ++j) {
-        if (!std::isnan(intersect_.obstacleLow.at(lineIdx).at(j)) &&
-            !std::isnan(intersect_.obstacleUpp.at(lineIdx).at(j))) {
-            obsSegment.push_back({intersect_.obstacleLow.at(lineIdx).at(j),
-                                  intersect_.obstacleUpp.at(lineIdx).at(j)});
+    for (auto j = 0; j < intersect.obstacleLow.at(lineIdx).size(); ++j) {
+        if (!std::isnan(intersect.obstacleLow.at(lineIdx).at(j)) &&
+            !std::isnan(intersect.obstacleUpp.at(lineIdx).at(j))) {
+            obsSegment.push_back({intersect.obstacleLow.at(lineIdx).at(j),
+                                  intersect.obstacleUpp.at(lineIdx).at(j)});
         }
     }
 
@@ -129,13 +150,14 @@ FreeSpaceComputator<RobotType, ObjectType>::computeSweepLineFreeSegment(
 }
 
 template <typename RobotType, typename ObjectType>
-void FreeSpaceComputator<RobotType, ObjectType>::enhanceFreeSegment() {
-    FreeSegment2D enhanced = segment_;
+void FreeSpaceComputator<RobotType, ObjectType>::enhanceFreeSegment(
+    FreeSegment2D& segment) const {
+    FreeSegment2D enhanced = segment;
 
     // Add new vertices within on sweep line
-    for (size_t i = 0; i < segment_.ty.size() - 1; ++i) {
-        for (size_t j1 = 0; j1 < segment_.xM[i].size(); ++j1) {
-            for (size_t j2 = 0; j2 < segment_.xM[i + 1].size(); ++j2) {
+    for (size_t i = 0; i < segment.ty.size() - 1; ++i) {
+        for (size_t j1 = 0; j1 < segment.xM[i].size(); ++j1) {
+            for (size_t j2 = 0; j2 < segment.xM[i + 1].size(); ++j2) {
                 if (enhanced.xM[i][j1] < enhanced.xL[i + 1][j2] &&
                     enhanced.xU[i][j1] >= enhanced.xL[i + 1][j2]) {
                     enhanced.xU[i].push_back(enhanced.xL[i + 1][j2]);
@@ -170,7 +192,7 @@ void FreeSpaceComputator<RobotType, ObjectType>::enhanceFreeSegment() {
              [](double a, double b) { return a < b; });
     }
 
-    segment_ = enhanced;
+    segment = enhanced;
 }
 
 }  // namespace hrm
@@ -40,6 +40,23 @@ struct FreeSegment2D {
     std::vector<std::vector<Coordinate>> xM;
 };
 
+/** \brief Working state of the sweep-line process for one task, so that
+ * sweep lines can be processed concurrently without sharing intersections
+ * and free segments */
+struct SweepLineWorkspace {
+    /** \brief Intervals of line intersections */
+    IntersectionInterval intersect;
+
+    /** \brief C-free segments */
+    FreeSegment2D segment;
+
+    /** \brief Number of intersection queries */
+    Index numRayCast = 0;
+
+    /** \brief Number of exact line-triangle tests */
+    Index numTriangleTest = 0;
+};
+
 /** \class FreeSpaceComputator
  * \brief Class for constructing free space */
 template <typename RobotType, typename ObjectType>
@@ -79,6 +96,14 @@ class FreeSpaceComputator {
      * \return Collision-free line segment as FreeSegment2D type */
     const FreeSegment2D& getFreeSegment() const { return segment_; }
 
+    /** \brief Get the number of intersection queries between sweep lines and
+     * C-space boundaries, accumulated since construction */
+    Index getNumRayCast() const { return numRayCast_; }
+
+    /** \brief Get the number of exact line-triangle tests, accumulated since
+     * construction */
+    Index getNumTriangleTest() const { return numTriangleTest_; }
+
     /** \brief Compute C-space boundary */
     void computeCSpaceBoundary();
 
@@ -92,15 +117,40 @@ class FreeSpaceComputator {
      * \param ty vector of y-coordinates of the sweep line */
     void computeFreeSegment(const std::vector<Coordinate>& ty);
 
+    /** \brief Compute collision-free segment on each sweep line from given
+     * intersections, without modifying the computator
+     * \param ty vector of y-coordinates of the sweep line
+     * \param intersect Intervals of line intersections
+     * \param segment Collision-free line segments */
+    void computeFreeSegment(const std::vector<Coordinate>& ty,
+                            const IntersectionInterval& intersect,
+                            FreeSegment2D& segment) const;
+
+    /** \brief Initialize a workspace
+     * \param workspace Working state of the sweep-line process
+     * \param numLine Number of sweep lines, which grows when the roadmap is
+     * refined */
+    void initWorkspace(SweepLineWorkspace& workspace,
+                       const unsigned int numLine) const;
+
   protected:
+    /** \brief Initialize intervals of line intersections
+     * \param intersect Intervals of line intersections
+     * \param numLine Number of sweep lines */
+    void initIntersectionInterval(IntersectionInterval& intersect,
+                                  const unsigned int numLine) const;
+
     /** \brief Compute free segment in each sweep line
+     * \param intersect Intervals of line intersections
      * \param lineIdx Index of the sweep line
      * \return Vector of Interval object */
     std::vector<Interval> computeSweepLineFreeSegment(
-        const Eigen::Index& lineIdx);
+        const IntersectionInterval& intersect,
+        const Eigen::Index& lineIdx) const;
 
-    /** \brief Enhance free segment generation for more vertices */
-    virtual void enhanceFreeSegment();
+    /** \brief Enhance free segment generation for more vertices
+     * \param segment Collision-free line segments */
+    virtual void enhanceFreeSegment(FreeSegment2D& segment) const;
 
     /** \param Robot description */
     RobotType robot_;
@@ -125,6 +175,12 @@ class FreeSpaceComputator {
 
     /** \brief Upper bound of arena */
     double upBound_;
+
+    /** \brief Counter of intersection queries */
+    Index numRayCast_ = 0;
+
+    /** \brief Counter of exact line-triangle tests */
+    Index numTriangleTest_ = 0;
 };
 
 }  // namespace hrm
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "FreeSpace.h"
+#include "IntervalTree.h"
 #include "MultiBodyTree3D.h"
 #include "hrm/geometry/SuperQuadrics.h"
 
@@ -48,12 +49,52 @@ class FreeSpace3D : public FreeSpaceComputator<MultiBodyTree3D, SuperQuadrics> {
     void computeIntersectionInterval(
         const std::vector<std::vector<Coordinate>>& tLine) override;
 
+    /** \brief Compute intervals of intersections between the sweep lines of
+     * one plane and arenas/obstacles, using only the given workspace. Planes
+     * can be processed concurrently with separate workspaces
+     * \param tx x-coordinate of the plane of sweep lines
+     * \param ty y-coordinates of the sweep lines
+     * \param workspace Working state initialized by initWorkspace */
+    void computeIntersectionInterval(const Coordinate tx,
+                                     const std::vector<Coordinate>& ty,
+                                     SweepLineWorkspace& workspace) const;
+
     /** \brief Compute C-free boundary as mesh
      * \param bound C-arena/C-obstacle boundary points*/
     void computeCSpaceBoundaryMesh(const BoundaryInfo& bound);
 
+    /** \brief Set C-free boundary mesh of a stored C-slice
+     * \param mesh C-arena/C-obstacle boundary mesh */
+    void setCSpaceBoundaryMesh(const BoundaryMesh& mesh);
+
   private:
+    /** \brief Compute intervals of intersections between the sweep lines of
+     * one plane and arenas/obstacles
+     * \param tx x-coordinate of the plane of sweep lines
+     * \param ty y-coordinates of the sweep lines
+     * \param intersect Intervals of line intersections
+     * \param numRayCast Counter of intersection queries
+     * \param numTriangleTest Counter of exact line-triangle tests */
+    void computeIntersectionInterval(const Coordinate tx,
+                                     const std::vector<Coordinate>& ty,
+                                     IntersectionInterval& intersect,
+                                     Index& numRayCast,
+                                     Index& numTriangleTest) const;
+
+    /** \brief Compute bounding boxes of C-obstacle meshes in xy-plane, used
+     * to cull C-obstacles for each sweep line */
+    void computeObstacleBoundingBox();
+
     BoundaryMesh cSpaceBoundaryMesh_;
+
+    /** \brief Interval tree of C-obstacle extents along x-axis */
+    IntervalTree obstacleTreeX_;
+
+    /** \brief Lower bounds of C-obstacle extents along y-axis */
+    std::vector<Coordinate> obstacleLowY_;
+
+    /** \brief Upper bounds of C-obstacle extents along y-axis */
+    std::vector<Coordinate> obstacleUppY_;
 };
 
 }  // namespace hrm
@@ -0,0 +1,60 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "DataType.h"
+
+#include <vector>
+
+namespace hrm {
+
+/** \class IntervalTree
+ * \brief Static tree of closed intervals on a line for stabbing queries. The
+ * intervals are sorted by lower bounds and stored as an implicit balanced
+ * binary tree, each node keeps the maximum upper bound of its subtree */
+class IntervalTree {
+  public:
+    IntervalTree();
+
+    ~IntervalTree();
+
+    /** \brief Build the tree, replacing the stored intervals. Intervals with
+     * NaN bounds are ignored
+     * \param low Lower bounds of the intervals
+     * \param upp Upper bounds of the intervals, same size as low */
+    void build(const std::vector<Coordinate>& low,
+               const std::vector<Coordinate>& upp);
+
+    /** \brief Find all the intervals containing a point
+     * \param point Coordinate of the query point
+     * \param result Indices of intervals in the input of build, appended in
+     * no particular order */
+    void query(const Coordinate point, std::vector<Index>& result) const;
+
+    /** \brief Number of stored intervals */
+    Index size() const { return low_.size(); }
+
+  private:
+    /** \brief Compute maximum upper bounds of the subtree in [begin, end)
+     * \return Maximum upper bound */
+    Coordinate buildSubtree(const Index begin, const Index end);
+
+    /** \brief Query the subtree in [begin, end) */
+    void querySubtree(const Index begin, const Index end,
+                      const Coordinate point,
+                      std::vector<Index>& result) const;
+
+    /** \brief Lower bounds in ascending order */
+    std::vector<Coordinate> low_;
+
+    /** \brief Upper bounds, in the order of lower bounds */
+    std::vector<Coordinate> upp_;
+
+    /** \brief Maximum upper bound of the subtree rooted at each node */
+    std::vector<Coordinate> maxUpp_;
+
+    /** \brief Indices of intervals in the input */
+    std::vector<Index> id_;
+};
+
+}  // namespace hrm
@@ -0,0 +1,153 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "DataType.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace hrm {
+
+/** \class VertexList
+ * \brief Compact list of roadmap vertices. A vertex on the sweep-line lattice
+ * of a C-slice is coded by the index of the robot shape (C-slice), indices of
+ * the coordinates of the sweep line and the coordinate along the sweep line
+ * in single precision. Vertices that do not follow the layout, as well as
+ * bridge vertices, are kept in full in an exception table. Full
+ * configurations are decoded on demand */
+class VertexList {
+  public:
+    VertexList();
+
+    /** \brief Constructor, all the vertices are kept in full
+     * \param vertex List of configurations */
+    VertexList(const std::vector<std::vector<Coordinate>>& vertex);
+
+    /** \brief Constructor, all the vertices are kept in full
+     * \param vertex List of configurations */
+    VertexList(std::initializer_list<std::vector<Coordinate>> vertex);
+
+    ~VertexList();
+
+    /** \brief Set the layout of lattice vertices, existing vertices are
+     * cleared. For 3D, (x, y) are the sweep-line coordinates and z is along
+     * the sweep line. For 2D, y is the sweep-line coordinate and x is along
+     * the sweep line. The remaining coordinates define the robot shape
+     * \param dim Dimension of translation (2 or 3), 0 for keeping all the
+     * vertices in full */
+    void setLayout(const Index dim);
+
+    /** \brief Number of vertices */
+    Index size() const { return code_.size(); }
+
+    /** \brief Whether the list is empty */
+    bool empty() const { return code_.empty(); }
+
+    /** \brief Remove all the vertices, keeping the layout */
+    void clear();
+
+    /** \brief Append a vertex
+     * \param v Configuration of the vertex */
+    void push_back(const std::vector<Coordinate>& v);
+
+    /** \brief Append a vertex kept in full, e.g. bridge vertices that are
+     * not on the lattice
+     * \param v Configuration of the vertex */
+    void pushException(const std::vector<Coordinate>& v);
+
+    /** \brief Append all the vertices of another list, vertices kept in
+     * full stay in the exception table
+     * \param other List of vertices */
+    void append(const VertexList& other);
+
+    /** \brief Decode a vertex
+     * \param i Index of the vertex
+     * \return Configuration of the vertex */
+    std::vector<Coordinate> operator[](const Index i) const;
+
+    /** \brief Decode a vertex with range checking
+     * \param i Index of the vertex
+     * \return Configuration of the vertex */
+    std::vector<Coordinate> at(const Index i) const;
+
+    /** \brief Decode a vertex into an existing configuration, avoiding
+     * allocations in loops
+     * \param i Index of the vertex
+     * \param v Configuration of the vertex */
+    void decode(const Index i, std::vector<Coordinate>& v) const;
+
+    /** \brief Decode one coordinate of a vertex
+     * \param i Index of the vertex
+     * \param k Index of the coordinate
+     * \return Coordinate value */
+    Coordinate getCoordinate(const Index i, const Index k) const;
+
+    /** \brief Euclidean distance between two vertices, only translations are
+     * compared if both vertices are on the same C-slice
+     * \param i, j Indices of the vertices
+     * \return Distance */
+    double getDistance(const Index i, const Index j) const;
+
+    /** \brief Number of vertices in the exception table */
+    Index getNumException() const { return exception_.size(); }
+
+    /** \brief Approximate memory of the stored vertices in bytes, excluding
+     * the lookup tables of the lattice
+     * \return Number of bytes */
+    Index getMemorySize() const;
+
+  private:
+    /** \brief Code of one vertex */
+    struct Code {
+        /** \brief Index of the robot shape, or EXCEPTION */
+        std::uint32_t shape;
+
+        /** \brief Indices of the sweep-line coordinates, or index in the
+         * exception table */
+        std::uint32_t grid[2];
+
+        /** \brief Coordinate along the sweep line */
+        float z;
+    };
+
+    /** \brief Shape index of vertices in the exception table */
+    static constexpr std::uint32_t EXCEPTION = UINT32_MAX;
+
+    /** \brief Index of a value in the coordinates of one sweep-line axis,
+     * added if not exist */
+    std::uint32_t getGridIndex(const Index axis, const Coordinate value);
+
+    /** \brief Dimension of translation, 0 if all the vertices are kept in
+     * full */
+    Index dim_ = 0;
+
+    /** \brief Axes of the sweep-line coordinates */
+    std::vector<Index> gridAxis_;
+
+    /** \brief Axis along the sweep line */
+    Index lineAxis_ = 0;
+
+    /** \brief Codes of vertices */
+    std::vector<Code> code_;
+
+    /** \brief Coordinates of sweep lines along each axis */
+    std::vector<std::vector<Coordinate>> grid_;
+
+    /** \brief Lookup table of the sweep-line coordinates */
+    std::vector<std::unordered_map<Coordinate, std::uint32_t>> gridIdx_;
+
+    /** \brief Robot shapes, i.e. coordinates other than translation */
+    std::vector<std::vector<Coordinate>> shape_;
+
+    /** \brief Lookup table of the robot shapes */
+    std::map<std::vector<Coordinate>, std::uint32_t> shapeIdx_;
+
+    /** \brief Vertices kept in full */
+    std::vector<std::vector<Coordinate>> exception_;
+};
+
+}  // namespace hrm
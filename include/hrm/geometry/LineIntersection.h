@@ -15,18 +15,65 @@ namespace hrm {
 std::vector<Point3D> intersectLineMesh3D(const Line3D& line,
                                          const MeshMatrix& shape);
 
-std::vector<Point3D> intersectVerticalLineMesh3D(const Line3D& line,
-                                                 const MeshMatrix& shape);
+/** \brief Intersections between a vertical line and a mesh
+ * \param numTriangleTest Counter of exact line-triangle tests, incremented
+ * if not null */
+std::vector<Point3D> intersectVerticalLineMesh3D(
+    const Line3D& line, const MeshMatrix& shape,
+    Index* numTriangleTest = nullptr);
+
+/** \brief Intersections between a vertical line and the faces of a mesh,
+ * without rejecting by the bounding box of the whole mesh. Used when the
+ * caller has already culled the mesh by its bounding box
+ * \param numTriangleTest Counter of exact line-triangle tests, incremented
+ * if not null */
+std::vector<Point3D> intersectVerticalLineMeshFaces3D(
+    const Line3D& line, const MeshMatrix& shape,
+    Index* numTriangleTest = nullptr);
 
 bool intersectLineTriangle3D(const Line3D& line, const Eigen::Vector3d& t0,
                              const Eigen::Vector3d& u, const Eigen::Vector3d& v,
                              Point3D& pt);
 
+/** \brief Check whether a line segment crosses the boundary of a polygon.
+ * Touching at end points or vertices is not counted
+ * \param seg End points of the line segment
+ * \param shape Vertices of the polygon */
 bool isIntersectSegPolygon2D(
     const std::pair<std::vector<double>, std::vector<double>>& seg,
-    const Eigen::Matrix2Xd& shape);
+    const BoundaryPoints& shape);
+
+/** \brief Conservative check of a line segment against an axis-aligned box,
+ * used to reject polygons before isIntersectSegPolygon2D
+ * \param seg End points of the line segment
+ * \param box Axis-aligned bounding box
+ * \return false only if the segment and the box are disjoint */
+bool isIntersectSegBox2D(
+    const std::pair<std::vector<double>, std::vector<double>>& seg,
+    const Eigen::AlignedBox2d& box);
+
+/** \brief Axis-aligned bounding box of the vertices of a polygon */
+Eigen::AlignedBox2d getBoundingBox2D(const BoundaryPoints& shape);
 
 std::vector<double> intersectHorizontalLinePolygon2D(
     const double ty, const Eigen::Matrix2Xd& shape);
 
+/** \brief Intersections between horizontal lines and polygons by a scanline
+ * sweep. Edges of all the polygons are sorted by y-coordinates once, and an
+ * active edge table is kept while stepping through the lines in ascending
+ * order. Results are the same as intersectHorizontalLinePolygon2D for each
+ * pair of line and polygon
+ * \param ty y-coordinates of the lines, in any order
+ * \param shapes Polygons
+ * \param low Lower x-coordinates of intersections, indexed by line and then
+ * polygon, NaN if not intersected. Each of the first ty.size() rows should
+ * have shapes.size() entries
+ * \param upp Upper x-coordinates of intersections, same layout as low
+ * \param numQuery Counter of pairs of line and polygon with active edges,
+ * incremented if not null */
+void intersectHorizontalLinesPolygons2D(
+    const std::vector<double>& ty, const std::vector<BoundaryPoints>& shapes,
+    std::vector<std::vector<double>>& low,
+    std::vector<std::vector<double>>& upp, Index* numQuery = nullptr);
+
 }  // namespace hrm
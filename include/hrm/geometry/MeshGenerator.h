@@ -8,6 +8,8 @@
 
 #include <fcl/fcl.h>
 
+#include <memory>
+
 namespace hrm {
 
 /** \brief Mesh as a structure of vertices and triangles */
@@ -19,13 +21,17 @@ struct Mesh {
     std::vector<fcl::Triangle> triangles;
 };
 
-/** \brief Mesh with vertices and faces stored in MatrixXd format */
+/** \brief Triangle faces, each row stores indices of three vertices */
+using MeshFaces = Eigen::Matrix<int, Eigen::Dynamic, 3, Eigen::RowMajor>;
+
+/** \brief Mesh with vertices stored in MatrixXd format */
 struct MeshMatrix {
     /** \brief List of vertices */
     BoundaryPoints vertices;
 
-    /** \brief Faces in the matrix format */
-    Eigen::MatrixXd faces;
+    /** \brief Faces in the matrix format, immutable and shared by all the
+     * meshes with the same topology */
+    std::shared_ptr<const MeshFaces> faces;
 };
 
 /** \brief Vectors of point coordinates */
@@ -40,10 +46,15 @@ struct ParametricPoints {
     std::vector<Coordinate> z;
 };
 
-/** \brief Get mesh info from SuperQuadrics class */
+/** \brief Get closed surface mesh of SuperQuadrics at the origin. The
+ * (eta, omega) parameter grid is triangulated directly, with single vertices
+ * at the poles and the longitude wrapped around
+ * \param sq SuperQuadrics object, number of parameters as resolution
+ * \return Mesh with outward-oriented triangles */
 Mesh getMeshFromSQ(const SuperQuadrics& sq);
 
-/** \brief Get mesh info from 3D point cloud */
+/** \brief Get mesh info from 3D point cloud by Delaunay triangulation, the
+ * faces of all the tetrahedra are included */
 Mesh getMesh(const ParametricPoints& points);
 
 /** \brief Get 3D point cloud from SuperQuadric class */
@@ -51,7 +62,16 @@ ParametricPoints getBoundary3D(const SuperQuadrics& obj);
 
 ParametricPoints getBoundaryFromMatrix(const BoundaryPoints& ptsMat);
 
-MeshMatrix getMeshFromParamSurface(const BoundaryPoints& surfBound,
-                                   const Index n);
+/** \brief Get mesh from points on a parametric surface
+ * \param surfBound Surface points sampled on n x n parameter grid
+ * \param n Number of samples for each parameter
+ * \return MeshMatrix referencing the shared faces of the grid */
+MeshMatrix getMeshFromParamSurface(BoundaryPoints surfBound, const Index n);
+
+/** \brief Get triangle faces of the parameter grid. The faces only depend on
+ * the resolution, and are generated once and shared afterwards
+ * \param n Number of samples for each parameter
+ * \return Pointer to the immutable faces */
+std::shared_ptr<const MeshFaces> getParamSurfaceFaces(const Index n);
 
 }  // namespace hrm
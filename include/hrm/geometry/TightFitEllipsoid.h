@@ -5,6 +5,8 @@
 #include "SuperEllipse.h"
 #include "SuperQuadrics.h"
 
+#include <map>
+
 namespace hrm {
 
 /** \brief compute Minimum volume concentric ellipsoid */
@@ -28,4 +30,41 @@ SuperQuadrics getTFE3D(const std::vector<double>& a,
                        const Eigen::Quaterniond& quatB, const Index numStep,
                        const Index num);
 
+/** \class TFECache
+ * \brief Memoised tightly-fitted ellipsoids. The results are keyed by the
+ * semi-axes of the body, the pair of orientations and the resolutions, so
+ * that the same bridge C-slice is computed once per planner. Not thread-safe
+ */
+class TFECache {
+  public:
+    TFECache();
+
+    ~TFECache();
+
+    /** \brief Tightly-fitted ellipse, computed by getTFE2D if not cached */
+    SuperEllipse getTFE2D(const std::vector<double>& a, const double thetaA,
+                          const double thetaB, const Index numStep,
+                          const Index num);
+
+    /** \brief Tightly-fitted ellipsoid, computed by getTFE3D if not cached */
+    SuperQuadrics getTFE3D(const std::vector<double>& a,
+                           const Eigen::Quaterniond& quatA,
+                           const Eigen::Quaterniond& quatB,
+                           const Index numStep, const Index num);
+
+    /** \brief Number of cached results */
+    Index size() const { return tfe2D_.size() + tfe3D_.size(); }
+
+    /** \brief Number of queries answered from the cache */
+    Index getNumHit() const { return numHit_; }
+
+    /** \brief Remove all the cached results */
+    void clear();
+
+  private:
+    std::map<std::vector<double>, SuperEllipse> tfe2D_;
+    std::map<std::vector<double>, SuperQuadrics> tfe3D_;
+    Index numHit_ = 0;
+};
+
 }  // namespace hrm
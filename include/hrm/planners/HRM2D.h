@@ -5,6 +5,7 @@
 #include "HighwayRoadMap.h"
 #include "hrm/datastructure/FreeSpace2D.h"
 #include "hrm/geometry/TightFitEllipsoid.h"
+#include "hrm/util/InterpolateSE3.h"
 
 namespace hrm {
 namespace planners {
@@ -57,12 +58,25 @@ class HRM2D : public HighwayRoadMap<MultiBodyTree2D, SuperEllipse> {
     bool isPtInCFree(const Index bdIdx,
                      const std::vector<Coordinate>& v) override;
 
+    bool isSameSliceSegmentFree(
+        const std::vector<Coordinate>& v1,
+        const std::vector<Coordinate>& v2) const override;
+
+    bool setPathSlice(const std::vector<Coordinate>& v) override;
+
+    void setPathBridgeSlice(const std::vector<Coordinate>& v1,
+                            const std::vector<Coordinate>& v2) override;
+
     std::vector<Vertex> getNearestNeighborsOnGraph(
         const std::vector<Coordinate>& vertex, const Index k,
         const double radius) override;
 
     virtual void setTransform(const std::vector<Coordinate>& v) override;
 
+    /** \brief Set the transformation for robot from fixed-size configuration
+     * \param v SE(2) configuration of the robot */
+    void setTransformSE2(const ConfigurationSE2& v);
+
     /** \brief Compute Tightly-Fitted Ellipse (TFE) to enclose robot parts when
      * rotating around its center
      * \param thetaA Start heading angle of the robot
@@ -75,12 +89,21 @@ class HRM2D : public HighwayRoadMap<MultiBodyTree2D, SuperEllipse> {
     /** \param Sampled heading angles of the robot */
     std::vector<double> headings_;
 
+    /** \param Interpolated configurations between C-slices */
+    ConfigurationList<3> vInterp_;
+
     /** \param Collision-free line segment */
     FreeSegment2D freeSegOneSlice_;
 
+    /** \param Bounding boxes of C-obstacles at current C-slice */
+    std::vector<Eigen::AlignedBox2d> sliceBoundBox_;
+
     /** \param Minkowski boundaries at bridge C-slice */
     std::vector<BoundaryInfo> bridgeSliceBound_;
 
+    /** \param Memoised TFEs, reused across bridge C-slices and refinement */
+    TFECache tfeCache_;
+
     /** \param Pointer to class for constructing free space */
     std::shared_ptr<FreeSpace2D> freeSpacePtr_;
 };
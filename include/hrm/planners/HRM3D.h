@@ -8,6 +8,7 @@
 #include "hrm/geometry/MeshGenerator.h"
 #include "hrm/geometry/TightFitEllipsoid.h"
 #include "hrm/util/InterpolateSE3.h"
+#include "hrm/util/SO3Grid.h"
 
 namespace hrm {
 namespace planners {
@@ -41,14 +42,15 @@ class HRM3D : public HighwayRoadMap<MultiBodyTree3D, SuperQuadrics> {
         return freeSegOneSlice_;
     }
 
-    /** \brief Get Minkowski sums boundary mesh
+    /** \brief Get Minkowski sums boundary mesh, not stored in streaming mode
+     * (see PlannerParameter::isStreamingSlice)
      * \param idx Index of C-slice
      * \return Boundary mesh */
     const BoundaryMesh& getSliceBoundaryMesh(const Index idx) const {
         return sliceBoundMeshAll_.at(idx);
     }
 
-    /** \brief Get Minkowski sums boundary
+    /** \brief Get Minkowski sums boundary, not stored in streaming mode
      * \param idx Index of C-slice
      * \return Boundary */
     const BoundaryInfo& getSliceBoundary(const Index idx) const {
@@ -99,14 +101,34 @@ class HRM3D : public HighwayRoadMap<MultiBodyTree3D, SuperQuadrics> {
     bool isPtInCFree(const Index bdIdx,
                      const std::vector<Coordinate>& v) override;
 
-    /** \brief uniform random sample SO(3) */
+    bool isSameSliceSegmentFree(
+        const std::vector<Coordinate>& v1,
+        const std::vector<Coordinate>& v2) const override;
+
+    bool setPathSlice(const std::vector<Coordinate>& v) override;
+
+    void setPathBridgeSlice(const std::vector<Coordinate>& v1,
+                            const std::vector<Coordinate>& v2) override;
+
+    /** \brief Deterministic uniform samples of SO(3), or the pre-defined ones
+     * of the robot, with the table of nearest C-slices */
     void sampleSO3();
 
     virtual void setTransform(const std::vector<Coordinate>& v) override;
 
+    /** \brief Set the transformation for robot from fixed-size configuration
+     * \param v SE(3) configuration of the robot */
+    void setTransformSE3(const ConfigurationSE3& v);
+
     /** \param Sampled orientations (Quaternion) of the robot */
     std::vector<Eigen::Quaterniond> q_;
 
+    /** \param Nearest C-slices of each C-slice, from the nearest */
+    std::vector<std::vector<Index>> sliceNeighbor_;
+
+    /** \param Number of nearest C-slices in the table */
+    static constexpr Index NUM_SLICE_NEIGHBOR = 16;
+
     /** \param Boundary surface as mesh */
     BoundaryMesh sliceBoundMesh_;
 
@@ -119,8 +141,14 @@ class HRM3D : public HighwayRoadMap<MultiBodyTree3D, SuperQuadrics> {
     /** \param Minkowski boundaries mesh at bridge C-slice */
     std::vector<std::vector<MeshMatrix>> bridgeSliceBound_;
 
+    /** \param Memoised TFEs, reused across bridge C-slices and refinement */
+    TFECache tfeCache_;
+
     /** \param Pointer to class for constructing free space */
     std::shared_ptr<FreeSpace3D> freeSpacePtr_;
+
+    /** \param Interpolated rigid-body configurations between C-slices */
+    ConfigurationList<7> vInterp_;
 };
 
 }  // namespace planners
@@ -35,35 +35,79 @@ HRM3DAblation<Planner>::~HRM3DAblation() {}
 template <class Planner>
 bool HRM3DAblation<Planner>::isMultiSliceTransitionFree(
     const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
+    Planner::res_.operationCount.numTransitionCheck++;
+    if (Planner::param_.isContinuousCollision) {
+        return isMultiSliceTransitionFreeContinuous(v1, v2);
+    }
+
     // Interpolated robot motion from v1 to v2
-    std::vector<std::vector<Coordinate>> vInterp =
+    const std::vector<std::vector<Coordinate>> vInterp =
         interpolateCompoundSE3Rn(v1, v2, Planner::param_.numPoint);
 
-    for (auto vStep : vInterp) {
+    BodyPoses tfBody;
+    for (const auto& vStep : vInterp) {
         // Transform the robot
         Planner::setTransform(vStep);
+        getBodyPoses(tfBody);
 
-        for (size_t i = 0; i < Planner::obs_.size(); ++i) {
-            // Base: determine whether each step is in collision
-            if (isCollision(Planner::robot_.getBase(), objRobot_.at(0),
-                            Planner::obs_.at(i), objObs_.at(i))) {
+        // For each body, check whether each step is in collision
+        for (size_t j = 0; j < tfBody.size(); ++j) {
+            if (obsManager_.isCollision(objRobot_.at(j).collisionGeometry(),
+                                        tfBody.at(j))) {
                 return false;
             }
+        }
+    }
+
+    return true;
+}
+
+template <class Planner>
+bool HRM3DAblation<Planner>::isMultiSliceTransitionFreeContinuous(
+    const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
+    // Interpolated robot motion from v1 to v2
+    const std::vector<std::vector<Coordinate>> vInterp =
+        interpolateCompoundSE3Rn(v1, v2, Planner::param_.numPoint);
 
-            // For each link, check whether each step is in collision
-            for (size_t j = 0; j < Planner::robot_.getNumLinks(); ++j) {
-                if (isCollision(Planner::robot_.getLinks().at(j),
-                                objRobot_.at(j + 1), Planner::obs_.at(i),
-                                objObs_.at(i))) {
-                    return false;
-                }
+    // Poses of robot bodies at the previous and current steps
+    BodyPoses tfPrev;
+    BodyPoses tfCur;
+    for (size_t i = 0; i < vInterp.size(); ++i) {
+        Planner::setTransform(vInterp.at(i));
+        getBodyPoses(tfCur);
+
+        // Each body sweeps between the consecutive poses
+        for (size_t j = 0; i > 0 && j < tfCur.size(); ++j) {
+            if (obsManager_.isContinuousCollision(
+                    objRobot_.at(j).collisionGeometry(), tfPrev.at(j),
+                    tfCur.at(j))) {
+                return false;
             }
         }
+
+        std::swap(tfPrev, tfCur);
     }
 
     return true;
 }
 
+template <class Planner>
+void HRM3DAblation<Planner>::getBodyPoses(BodyPoses& tfBody) const {
+    auto getPose = [](const SuperQuadrics& body) {
+        fcl::Transform3d tf = fcl::Transform3d::Identity();
+        tf.linear() = body.getQuaternion().toRotationMatrix();
+        tf.translation() << body.getPosition().at(0), body.getPosition().at(1),
+            body.getPosition().at(2);
+        return tf;
+    };
+
+    tfBody.clear();
+    tfBody.push_back(getPose(Planner::robot_.getBase()));
+    for (const auto& link : Planner::robot_.getLinks()) {
+        tfBody.push_back(getPose(link));
+    }
+}
+
 template <class Planner>
 void HRM3DAblation<Planner>::bridgeSlice() {
     Planner::bridgeSliceBound_.clear();
@@ -102,7 +146,16 @@ void HRM3DAblation<Planner>::setCollisionObject() {
         } else {
             objObs_.push_back(setCollisionObjectFromSQ(obs));
         }
+
+        // Obstacles are static, pose only once
+        objObs_.back().setTransform(
+            obs.getQuaternion().toRotationMatrix(),
+            fcl::Vector3d(obs.getPosition().at(0), obs.getPosition().at(1),
+                          obs.getPosition().at(2)));
     }
+
+    // Register obstacles for broad-phase collision checking
+    obsManager_.setObstacles(objObs_);
 }
 
 }  // namespace planners
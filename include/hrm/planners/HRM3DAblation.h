@@ -4,6 +4,7 @@
 
 #include "HRM3D.h"
 #include "ProbHRM3D.h"
+#include "hrm/util/ObstacleCollisionManager.h"
 
 namespace hrm {
 namespace planners {
@@ -37,6 +38,11 @@ class HRM3DAblation : public Planner {
 
     ~HRM3DAblation() override;
 
+    /** \brief Not copyable or movable, since the obstacle manager refers to
+     * the collision objects of this instance */
+    HRM3DAblation(const HRM3DAblation&) = delete;
+    HRM3DAblation& operator=(const HRM3DAblation&) = delete;
+
   protected:
     /** \brief Check whether connection between v1 and v2 is valid through
      * interpolation and explicit collision detection
@@ -46,6 +52,19 @@ class HRM3DAblation : public Planner {
     bool isMultiSliceTransitionFree(const std::vector<Coordinate>& v1,
                                     const std::vector<Coordinate>& v2) override;
 
+    /** \brief Check whether connection between v1 and v2 is valid through
+     * continuous collision detection of each body between consecutive
+     * interpolated poses
+     * \param v1 The starting vertex
+     * \param v2 The goal vertex
+     * \return true if transition is valid, false otherwise */
+    bool isMultiSliceTransitionFreeContinuous(
+        const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2);
+
+    /** \brief Get poses of robot bodies at the current transformation
+     * \param tfBody Poses of robot bodies, base first */
+    void getBodyPoses(BodyPoses& tfBody) const;
+
     /** \brief Clear any stored bridge C-slice information */
     void bridgeSlice() override;
 
@@ -65,6 +84,10 @@ class HRM3DAblation : public Planner {
 
     /** \param FCL collision object for obstacles */
     std::vector<fcl::CollisionObject<double>> objObs_;
+
+    /** \param Broad-phase collision manager for obstacles, holds pointers to
+     * objObs_ */
+    ObstacleCollisionManager obsManager_;
 };
 
 }  // namespace planners
@@ -3,13 +3,16 @@
 #pragma once
 
 #include "HighwayRoadMap.h"
+#include "RoadmapSearch.h"
 #include "hrm/datastructure/Interval.h"
 #include "hrm/util/DistanceMetric.h"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <list>
 #include <random>
+#include <thread>
 
 namespace hrm {
 namespace planners {
@@ -26,8 +29,10 @@ template <class Vertex>
 class AStarGoalVisitor : public boost::default_astar_visitor {
   public:
     /** \brief Constructor
-     * \param goal Goal vertex */
-    AStarGoalVisitor(Vertex goal) : goal_(goal) {}
+     * \param goal Goal vertex
+     * \param numExpansion Counter of expanded vertices */
+    AStarGoalVisitor(Vertex goal, Index& numExpansion)
+        : goal_(goal), numExpansion_(numExpansion) {}
 
     /** \brief Examine whether reaches goal
      * \param u Current vertex
@@ -37,11 +42,15 @@ class AStarGoalVisitor : public boost::default_astar_visitor {
         if (u == goal_) {
             throw AStarFoundGoal();
         }
+        numExpansion_++;
     }
 
   private:
     /** \brief Goal vertex */
     Vertex goal_;
+
+    /** \brief Counter of expanded vertices */
+    Index& numExpansion_;
 };
 
 /** \class HighwayRoadMap
@@ -56,7 +65,10 @@ HighwayRoadMap<RobotType, ObjectType>::HighwayRoadMap(
       start_(req.start),
       goal_(req.goal),
       param_(req.parameters),
-      isRobotRigid_(req.isRobotRigid) {}
+      isRobotRigid_(req.isRobotRigid) {
+    // Vertices are coded on the sweep-line lattice of C-slices
+    res_.graphStructure.vertex.setLayout(param_.boundaryLimits.size() / 2);
+}
 
 template <class RobotType, class ObjectType>
 HighwayRoadMap<RobotType, ObjectType>::~HighwayRoadMap() {}
@@ -83,6 +95,9 @@ void HighwayRoadMap<RobotType, ObjectType>::plan(const double timeLim) {
     // Get solution path
     if (res_.solved) {
         res_.solutionPath.solvedPath = getSolutionPath();
+        if (param_.isShortcutPath) {
+            shortcutPath();
+        }
         res_.solutionPath.interpolatedPath =
             getInterpolatedSolutionPath(param_.numPoint);
     }
@@ -108,6 +123,11 @@ void HighwayRoadMap<RobotType, ObjectType>::buildRoadmap() {
 
 template <class RobotType, class ObjectType>
 void HighwayRoadMap<RobotType, ObjectType>::search() {
+    if (param_.searchStrategy != 0) {
+        searchRoadmap();
+        return;
+    }
+
     // Construct the roadmap
     const Index num_vtx = res_.graphStructure.vertex.size();
     AdjGraph g(num_vtx);
@@ -135,16 +155,15 @@ void HighwayRoadMap<RobotType, ObjectType>::search() {
                 boost::astar_search(
                     g, idxS,
                     [this, idxG](Vertex v) {
-                        return vectorEuclidean(
-                            res_.graphStructure.vertex[v],
-                            res_.graphStructure.vertex[idxG]);
+                        return res_.graphStructure.vertex.getDistance(v, idxG);
                     },
                     boost::predecessor_map(
                         boost::make_iterator_property_map(
                             p.begin(), get(boost::vertex_index, g)))
                         .distance_map(make_iterator_property_map(
                             d.begin(), get(boost::vertex_index, g)))
-                        .visitor(AStarGoalVisitor<Vertex>(idxG)));
+                        .visitor(AStarGoalVisitor<Vertex>(
+                            idxG, res_.operationCount.numSearchExpansion)));
             } catch (AStarFoundGoal found) {
                 // Record path and cost
                 num = 0;
@@ -174,6 +193,39 @@ void HighwayRoadMap<RobotType, ObjectType>::search() {
     }
 }
 
+template <class RobotType, class ObjectType>
+void HighwayRoadMap<RobotType, ObjectType>::searchRoadmap() {
+    RoadmapSearch roadmap(res_.graphStructure, landmarkTable_);
+
+    // Landmarks are shared by all the queries, and kept across searches as
+    // the roadmap grows
+    if (param_.searchStrategy == 2) {
+        roadmap.updateLandmarks(param_.numLandmark);
+    }
+
+    // Locate the nearest vertex for start and goal in the roadmap
+    const std::vector<Vertex> idx_s = getNearestNeighborsOnGraph(
+        start_, param_.numSearchNeighbor, param_.searchRadius);
+    const std::vector<Vertex> idx_g = getNearestNeighborsOnGraph(
+        goal_, param_.numSearchNeighbor, param_.searchRadius);
+
+    // Search for shortest path in the searching regions
+    for (Vertex idxS : idx_s) {
+        for (Vertex idxG : idx_g) {
+            const RoadmapSearchResult query = roadmap.search(
+                idxS, idxG, param_.searchStrategy, param_.searchWeight);
+            res_.operationCount.numSearchExpansion += query.numExpansion;
+
+            if (query.solved) {
+                res_.solutionPath.PathId = query.path;
+                res_.solutionPath.cost = query.cost;
+                res_.solved = true;
+                return;
+            }
+        }
+    }
+}
+
 template <class RobotType, class ObjectType>
 void HighwayRoadMap<RobotType, ObjectType>::refineExistRoadmap(
     const double timeLim) {
@@ -221,19 +273,25 @@ void HighwayRoadMap<RobotType, ObjectType>::connectOneSlice2D(
     Index n1 = 0;
     Index n2 = 0;
 
+    // Vertices are decoded once per pair into reused buffers
+    std::vector<Coordinate> v1;
+    std::vector<Coordinate> v2;
+
     for (size_t i = 0; i < freeSeg.ty.size(); ++i) {
         n1 = numVertex_.plane.at(i);
 
         for (size_t j1 = 0; j1 < freeSeg.xM[i].size(); ++j1) {
+            res_.graphStructure.vertex.decode(n1 + j1, v1);
+
             // Connect vertex within the same sweep line
             if (j1 != freeSeg.xM[i].size() - 1) {
                 if (std::fabs(freeSeg.xU[i][j1] - freeSeg.xL[i][j1 + 1]) <
                     1e-6) {
+                    res_.graphStructure.vertex.decode(n1 + j1 + 1, v2);
                     res_.graphStructure.edge.push_back(
                         std::make_pair(n1 + j1, n1 + j1 + 1));
-                    res_.graphStructure.weight.push_back(vectorEuclidean(
-                        res_.graphStructure.vertex[n1 + j1],
-                        res_.graphStructure.vertex[n1 + j1 + 1]));
+                    res_.graphStructure.weight.push_back(
+                        vectorEuclidean(v1, v2));
                 }
             }
 
@@ -242,15 +300,13 @@ void HighwayRoadMap<RobotType, ObjectType>::connectOneSlice2D(
                 n2 = numVertex_.plane.at(i + 1);
 
                 for (Index j2 = 0; j2 < freeSeg.xM[i + 1].size(); ++j2) {
-                    if (isSameSliceTransitionFree(
-                            res_.graphStructure.vertex[n1 + j1],
-                            res_.graphStructure.vertex[n2 + j2])) {
+                    res_.graphStructure.vertex.decode(n2 + j2, v2);
+                    if (isSameSliceTransitionFree(v1, v2)) {
                         // Direct success connection
                         res_.graphStructure.edge.push_back(
                             std::make_pair(n1 + j1, n2 + j2));
-                        res_.graphStructure.weight.push_back(vectorEuclidean(
-                            res_.graphStructure.vertex[n1 + j1],
-                            res_.graphStructure.vertex[n2 + j2]));
+                        res_.graphStructure.weight.push_back(
+                            vectorEuclidean(v1, v2));
                     } else {
                         bridgeVertex(n1 + j1, n2 + j2);
                     }
@@ -282,6 +338,187 @@ HighwayRoadMap<RobotType, ObjectType>::getSolutionPath() {
     return path;
 }
 
+template <class RobotType, class ObjectType>
+void HighwayRoadMap<RobotType, ObjectType>::shortcutPath() {
+    const auto start = Clock::now();
+    auto& path = res_.solutionPath.solvedPath;
+
+    // Consecutive waypoints with the same robot shape (coordinates other than
+    // translations) lie on one C-slice
+    const Index dim = param_.boundaryLimits.size() / 2;
+    auto isSameShape = [dim](const std::vector<Coordinate>& v1,
+                             const std::vector<Coordinate>& v2) {
+        for (size_t i = dim; i < v1.size(); ++i) {
+            if (std::fabs(v1[i] - v2.at(i)) > EPSILON) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<std::vector<std::vector<Coordinate>>> slicePath;
+    for (const auto& v : path) {
+        if (slicePath.empty() || !isSameShape(slicePath.back().back(), v)) {
+            slicePath.emplace_back();
+        }
+        slicePath.back().push_back(v);
+    }
+
+    // Shortcut within each C-slice, skipped if the C-slice is not stored
+    for (auto& onePath : slicePath) {
+        if (onePath.size() > 2 && setPathSlice(onePath.front())) {
+            onePath = shortcutOneSlice(onePath);
+        }
+    }
+
+    // Move the transition between adjacent C-slices. Multi-slice checks
+    // transform the robot, so the candidates are checked sequentially, the
+    // ones skipping more waypoints first. As in connectMultiSlice, only
+    // nearby waypoints are connected
+    for (size_t k = 0; k + 1 < slicePath.size(); ++k) {
+        auto& path1 = slicePath.at(k);
+        auto& path2 = slicePath.at(k + 1);
+        const Index maxSkip = path1.size() + path2.size() - 2;
+        if (maxSkip == 0) {
+            continue;
+        }
+
+        setPathBridgeSlice(path1.back(), path2.front());
+
+        bool isShortcut = false;
+        for (Index skip = maxSkip; skip > 0 && !isShortcut; --skip) {
+            // Skip (path1.size() - 1 - i) waypoints in path1 and j in path2
+            for (Index j = 0; j <= skip && j < path2.size(); ++j) {
+                if (skip - j >= path1.size()) {
+                    continue;
+                }
+
+                const Index i = path1.size() - 1 - (skip - j);
+                if (isMultiSliceAdjacent(path1.at(i), path2.at(j)) &&
+                    isMultiSliceTransitionFree(path1.at(i), path2.at(j))) {
+                    path1.resize(i + 1);
+                    path2.erase(path2.begin(), path2.begin() + j);
+                    isShortcut = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    path.clear();
+    for (const auto& onePath : slicePath) {
+        path.insert(path.end(), onePath.begin(), onePath.end());
+    }
+
+    res_.solutionPath.cost = 0.0;
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        res_.solutionPath.cost += vectorEuclidean(path.at(i), path.at(i + 1));
+    }
+
+    res_.planningTime.shortcutTime += Durationd(Clock::now() - start).count();
+}
+
+template <class RobotType, class ObjectType>
+bool HighwayRoadMap<RobotType, ObjectType>::isMultiSliceAdjacent(
+    const std::vector<Coordinate>& v1,
+    const std::vector<Coordinate>& v2) const {
+    // Spacing of sweep lines, x-axis has sweep lines only in 3D
+    const Index dim = param_.boundaryLimits.size() / 2;
+    std::vector<double> spacing(dim);
+    spacing.at(1) = (param_.boundaryLimits[3] - param_.boundaryLimits[2]) /
+                    static_cast<double>(param_.numLineY);
+    if (dim == 3) {
+        spacing.at(0) =
+            (param_.boundaryLimits[1] - param_.boundaryLimits[0]) /
+            static_cast<double>(param_.numLineX);
+        spacing.at(2) = std::fmin(spacing.at(0), spacing.at(1));
+    } else {
+        spacing.at(0) = spacing.at(1);
+    }
+
+    for (size_t i = 0; i < dim; ++i) {
+        if (std::fabs(v1.at(i) - v2.at(i)) > 2.0 * spacing.at(i)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class RobotType, class ObjectType>
+std::vector<std::vector<Coordinate>>
+HighwayRoadMap<RobotType, ObjectType>::shortcutOneSlice(
+    const std::vector<std::vector<Coordinate>>& path) {
+    const Index num = path.size();
+
+    // Candidate connections skip at least one waypoint
+    std::vector<std::pair<Index, Index>> candidate;
+    for (size_t i = 0; i < num; ++i) {
+        for (size_t j = i + 2; j < num; ++j) {
+            candidate.emplace_back(i, j);
+        }
+    }
+
+    // Candidates are independent, each worker checks an interleaved share
+    std::vector<char> isFree(candidate.size(), 0);
+    const Index numThread =
+        std::max(Index(1), std::min(param_.numThread, Index(candidate.size())));
+    auto worker = [&](const Index id) {
+        for (size_t k = id; k < candidate.size(); k += numThread) {
+            isFree.at(k) = isSameSliceSegmentFree(
+                path.at(candidate.at(k).first),
+                path.at(candidate.at(k).second));
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t id = 1; id < numThread; ++id) {
+        workers.emplace_back(worker, id);
+    }
+    worker(0);
+    for (auto& w : workers) {
+        w.join();
+    }
+    res_.operationCount.numTransitionCheck += candidate.size();
+
+    // Shortest path in order of the waypoints, consecutive waypoints are
+    // connected on the roadmap. Ties go to the longer shortcut
+    std::vector<std::vector<char>> isEdge(num, std::vector<char>(num, 0));
+    for (size_t i = 0; i + 1 < num; ++i) {
+        isEdge.at(i).at(i + 1) = 1;
+    }
+    for (size_t k = 0; k < candidate.size(); ++k) {
+        isEdge.at(candidate.at(k).first).at(candidate.at(k).second) =
+            isFree.at(k);
+    }
+
+    std::vector<double> dist(num, INFINITY);
+    std::vector<Index> prev(num, 0);
+    dist.at(0) = 0.0;
+    for (size_t j = 1; j < num; ++j) {
+        for (size_t i = 0; i < j; ++i) {
+            if (!isEdge.at(i).at(j)) {
+                continue;
+            }
+
+            const double d =
+                dist.at(i) + vectorEuclidean(path.at(i), path.at(j));
+            if (d < dist.at(j)) {
+                dist.at(j) = d;
+                prev.at(j) = i;
+            }
+        }
+    }
+
+    std::vector<std::vector<Coordinate>> pathShortcut = {path.back()};
+    for (Index j = num - 1; j != 0; j = prev.at(j)) {
+        pathShortcut.push_back(path.at(prev.at(j)));
+    }
+    std::reverse(pathShortcut.begin(), pathShortcut.end());
+
+    return pathShortcut;
+}
+
 template <class RobotType, class ObjectType>
 std::vector<std::vector<double>>
 HighwayRoadMap<RobotType, ObjectType>::getInterpolatedSolutionPath(
@@ -294,8 +531,9 @@ HighwayRoadMap<RobotType, ObjectType>::getInterpolatedSolutionPath(
 template <class RobotType, class ObjectType>
 void HighwayRoadMap<RobotType, ObjectType>::bridgeVertex(const Index idx1,
                                                          const Index idx2) {
-    const auto v1 = res_.graphStructure.vertex.at(idx1);
-    const auto v2 = res_.graphStructure.vertex.at(idx2);
+    // Decoded copies of the two vertices
+    const std::vector<Coordinate> v1 = res_.graphStructure.vertex.at(idx1);
+    const std::vector<Coordinate> v2 = res_.graphStructure.vertex.at(idx2);
 
     // Generate new bridge vertex
     auto vNew1 = v1;
@@ -303,22 +541,24 @@ void HighwayRoadMap<RobotType, ObjectType>::bridgeVertex(const Index idx1,
     auto vNew2 = v2;
     vNew2.at(2) = v1.at(2);
 
-    auto vNew = v1;
+    std::vector<Coordinate> vNew;
 
     // Check validity of potential connections
     if (isSameSliceTransitionFree(v1, vNew1) &&
         isSameSliceTransitionFree(vNew1, v2)) {
-        vNew = vNew1;
+        vNew = std::move(vNew1);
     } else if (isSameSliceTransitionFree(v1, vNew2) &&
                isSameSliceTransitionFree(vNew2, v2)) {
-        vNew = vNew2;
+        vNew = std::move(vNew2);
     } else {
         return;
     }
 
-    // Add new bridge vertex to graph is new connection is valid
+    // Add new bridge vertex to graph is new connection is valid, kept off
+    // the lattice
+    res_.operationCount.numBridgeVertex++;
     int idxNew = res_.graphStructure.vertex.size();
-    res_.graphStructure.vertex.push_back(vNew);
+    res_.graphStructure.vertex.pushException(vNew);
     res_.graphStructure.edge.push_back(std::make_pair(idx1, idxNew));
     res_.graphStructure.weight.push_back(vectorEuclidean(v1, vNew));
     res_.graphStructure.edge.push_back(std::make_pair(idxNew, idx2));
@@ -4,6 +4,7 @@
 
 #include "PlanningRequest.h"
 #include "PlanningResult.h"
+#include "RoadmapSearch.h"
 #include "hrm/datastructure/DataType.h"
 #include "hrm/datastructure/FreeSpace.h"
 
@@ -110,9 +111,35 @@ class HighwayRoadMap {
     /** \brief Subroutine for graph searching */
     void search();
 
+    /** \brief Subroutine for graph searching using strategies other than
+     * plain A*, see PlannerParameter::searchStrategy */
+    void searchRoadmap();
+
     /** \brief Subroutine for refining existing roadmap */
     void refineExistRoadmap(const double timeLim);
 
+    /** \brief Shortcut the solved path in place. Within each C-slice, the
+     * shortest path over the waypoints is found among the direct connections
+     * that pass the same-slice checks, which are evaluated in parallel. The
+     * transition between adjacent C-slices is then moved to skip waypoints
+     * where the multi-slice check allows */
+    void shortcutPath();
+
+    /** \brief Whether two configurations are close enough for the
+     * multi-slice check, which samples only a few poses. Translations are
+     * bounded by two sweep-line spacings along each axis, the axis along sweep
+     * lines uses the smaller spacing
+     * \param v1, v2 Configurations of the robot
+     * \return true if the multi-slice check applies, false otherwise */
+    bool isMultiSliceAdjacent(const std::vector<Coordinate>& v1,
+                              const std::vector<Coordinate>& v2) const;
+
+    /** \brief Shortcut waypoints within one C-slice
+     * \param path Waypoints on the current C-slice, see setPathSlice
+     * \return Waypoints of the shortcut path, keeping both ends */
+    std::vector<std::vector<Coordinate>> shortcutOneSlice(
+        const std::vector<std::vector<Coordinate>>& path);
+
     /** \brief Construct one C-slice */
     virtual void constructOneSlice(const Index sliceIdx) = 0;
 
@@ -171,6 +198,28 @@ class HighwayRoadMap {
     virtual bool isPtInCFree(const Index bdIdx,
                              const std::vector<Coordinate>& v) = 0;
 
+    /** \brief Check whether line segment V1-V2 avoids C-obstacles of the
+     * current C-slice. No member is modified, so that it can be called
+     * concurrently
+     * \param v1 The starting vertex
+     * \param v2 The goal vertex
+     * \return true if the segment is collision-free, false otherwise */
+    virtual bool isSameSliceSegmentFree(
+        const std::vector<Coordinate>& v1,
+        const std::vector<Coordinate>& v2) const = 0;
+
+    /** \brief Set the stored C-slice on which a configuration lies as the
+     * current C-slice
+     * \param v Configuration of the robot
+     * \return true if the C-slice is found, false otherwise */
+    virtual bool setPathSlice(const std::vector<Coordinate>& v) = 0;
+
+    /** \brief Construct bridge C-slice between the C-slices of two
+     * configurations
+     * \param v1, v2 Configurations of the robot */
+    virtual void setPathBridgeSlice(const std::vector<Coordinate>& v1,
+                                    const std::vector<Coordinate>& v2) = 0;
+
     /** \brief Find the nearest neighbors of a pose on the graph
      * \param vertex the queried vertex
      * \param k number of neighbors
@@ -231,6 +280,9 @@ class HighwayRoadMap {
 
     /** \param Tightly-fitted ellipsoids at bridge C-slice */
     std::vector<ObjectType> tfe_;
+
+    /** \param Landmarks of ALT search, updated as the roadmap grows */
+    LandmarkTable landmarkTable_;
 };
 
 }  // namespace planners
@@ -32,6 +32,36 @@ struct PlannerParameter {
 
     /** \brief Radius of nearest neighbor search for edge connections */
     double searchRadius = HALF_PI;
+
+    /** \brief Graph search strategy (0: A*; 1: bidirectional A*; 2: ALT,
+     * A* with landmarks; 3: weighted A*) */
+    Index searchStrategy = 0;
+
+    /** \brief Inflation factor of heuristic for weighted A*, the solved path
+     * cost is bounded by this factor times the optimal cost */
+    double searchWeight = 1.5;
+
+    /** \brief Number of landmarks for ALT search */
+    Index numLandmark = 8;
+
+    /** \brief Number of worker threads for constructing C-slices, sweep
+     * lines within a C-slice (HRM3D) and checking path shortcuts, 1 for
+     * sequential construction */
+    Index numThread = 1;
+
+    /** \brief Indicator of streaming C-slices. The boundaries of each C-slice
+     * are released once the C-slice is connected, and regenerated when the
+     * roadmap is refined. Saves memory for large number of C-slices */
+    bool isStreamingSlice = false;
+
+    /** \brief Indicator of continuous collision checking for connections
+     * between C-slices in ablated planners, otherwise only the interpolated
+     * poses are checked */
+    bool isContinuousCollision = false;
+
+    /** \brief Indicator of shortcutting the solved path. Waypoints are skipped
+     * if the direct connection passes the transition checks of the planner */
+    bool isShortcutPath = false;
 };
 
 /** \brief PlanningRequest user-defined parameters for planning */
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "hrm/datastructure/DataType.h"
+#include "hrm/datastructure/VertexList.h"
 
 #include <limits>
 #include <vector>
@@ -13,8 +14,8 @@ using Edge = std::vector<std::pair<Index, Index>>;
 
 /** \brief Graph structure storing the roadmap information */
 struct Graph {
-    /** \brief Vertex information */
-    std::vector<std::vector<Coordinate>> vertex;
+    /** \brief Vertex information, coded on the sweep-line lattice */
+    VertexList vertex;
 
     /** \brief Edge information */
     Edge edge;
@@ -25,7 +26,7 @@ struct Graph {
 
 /** \brief Information of solved path */
 struct SolutionPathInfo {
-    /** \brief Index list of solved path */
+    /** \brief Index list of solved path, before shortcutting */
     std::vector<Index> PathId;
 
     /** \brief List of configurations of the solved path */
@@ -34,10 +35,47 @@ struct SolutionPathInfo {
     /** \brief List of interpolated path */
     std::vector<std::vector<Coordinate>> interpolatedPath;
 
-    /** \brief Total cost */
+    /** \brief Total cost, or length of the path after shortcutting */
     double cost = 0.0;
 };
 
+/** \brief Time spent in each phase of roadmap construction (in seconds),
+ * accumulated over all the C-slices and refinements */
+struct PhaseTime {
+    /** \brief Minkowski sums of C-space boundaries */
+    double minkSumTime = 0.0;
+
+    /** \brief Meshing of C-space boundaries */
+    double meshTime = 0.0;
+
+    /** \brief Intersections between sweep lines and C-space boundaries */
+    double rayCastTime = 0.0;
+
+    /** \brief Collision-free segments on sweep lines */
+    double freeSegmentTime = 0.0;
+
+    /** \brief Vertex generation and connections within C-slices */
+    double connectOneSliceTime = 0.0;
+
+    /** \brief Tightly-fitted ellipsoids and bridge C-slices */
+    double bridgeSliceTime = 0.0;
+
+    /** \brief Transition checks between adjacent C-slices */
+    double connectMultiSliceTime = 0.0;
+
+    /** \brief Accumulate phase time from another construction */
+    PhaseTime& operator+=(const PhaseTime& other) {
+        minkSumTime += other.minkSumTime;
+        meshTime += other.meshTime;
+        rayCastTime += other.rayCastTime;
+        freeSegmentTime += other.freeSegmentTime;
+        connectOneSliceTime += other.connectOneSliceTime;
+        bridgeSliceTime += other.bridgeSliceTime;
+        connectMultiSliceTime += other.connectMultiSliceTime;
+        return *this;
+    }
+};
+
 /** \brief Roadmap building time and path search time */
 struct Time {
     /** \brief Roadmap building time (in seconds) */
@@ -48,6 +86,42 @@ struct Time {
 
     /** \brief Total planning time (in seconds) */
     double totalTime = 0.0;
+
+    /** \brief Path shortcutting time (in seconds), not included in total
+     * planning time */
+    double shortcutTime = 0.0;
+
+    /** \brief Time of each phase within roadmap building */
+    PhaseTime phaseTime;
+};
+
+/** \brief Counters of operations during planning */
+struct OperationCount {
+    /** \brief Number of intersection queries between sweep lines and
+     * C-space boundaries */
+    Index numRayCast = 0;
+
+    /** \brief Number of exact line-triangle tests in the queries */
+    Index numTriangleTest = 0;
+
+    /** \brief Number of transition checks within and between C-slices */
+    Index numTransitionCheck = 0;
+
+    /** \brief Number of bridge vertices added for failed connections */
+    Index numBridgeVertex = 0;
+
+    /** \brief Number of vertices expanded by graph search */
+    Index numSearchExpansion = 0;
+
+    /** \brief Accumulate counts from another construction */
+    OperationCount& operator+=(const OperationCount& other) {
+        numRayCast += other.numRayCast;
+        numTriangleTest += other.numTriangleTest;
+        numTransitionCheck += other.numTransitionCheck;
+        numBridgeVertex += other.numBridgeVertex;
+        numSearchExpansion += other.numSearchExpansion;
+        return *this;
+    }
 };
 
 /** \brief Result of planning */
@@ -63,6 +137,9 @@ struct PlanningResult {
 
     /** \brief Information of solved path */
     SolutionPathInfo solutionPath;
+
+    /** \brief Counters of operations */
+    OperationCount operationCount;
 };
 
 }  // namespace hrm
@@ -5,6 +5,8 @@
 #include "HRM3D.h"
 #include "hrm/util/ParseURDF.h"
 
+#include "ompl/util/RandomNumbers.h"
+
 namespace hrm {
 namespace planners {
 
@@ -29,6 +31,61 @@ class ProbHRM3D : public HRM3D {
     void plan(const double timeLim) override;
 
   protected:
+    /** \brief Roadmap information of one C-slice built independently from
+     * the main roadmap, indices of vertices are local to the C-slice */
+    struct SliceData {
+        /** \brief Configuration of the robot shape at the C-slice */
+        std::vector<Coordinate> config;
+
+        /** \brief Minkowski boundaries */
+        BoundaryInfo bound;
+
+        /** \brief Minkowski boundaries mesh */
+        BoundaryMesh boundMesh;
+
+        /** \brief Subgraph within the C-slice */
+        Graph graph;
+
+        /** \brief Vertex index info of the subgraph */
+        VertexIdx vertexIdx;
+
+        /** \brief Time of each phase spent on constructing the C-slice */
+        PhaseTime phaseTime;
+
+        /** \brief Operations performed on constructing the C-slice */
+        OperationCount operationCount;
+    };
+
+    /** \brief Sequentially sample, construct, connect and search C-slices
+     * \param timeLim Maximum planning time */
+    void planSequential(const double timeLim);
+
+    /** \brief Pipelined planning: worker threads sample configurations and
+     * construct C-slices in parallel, while the calling thread connects each
+     * finished C-slice to the roadmap and searches for a solution. Waiting
+     * for C-slices is bounded by the time limit, and exceptions thrown by
+     * workers are rethrown by the calling thread
+     * \param timeLim Maximum planning time */
+    void planParallel(const double timeLim);
+
+    /** \brief Sample a configuration for a new C-slice, the first two
+     * samples are the start and goal configurations
+     * \param sampleId Index of the sample
+     * \param rng Random number generator
+     * \return Orientation of base and joint angles */
+    std::vector<Coordinate> sampleConfiguration(const Index sampleId,
+                                                ompl::RNG& rng) const;
+
+    /** \brief Construct one C-slice as a standalone subgraph
+     * \param config Configuration of the robot shape
+     * \return SliceData structure */
+    SliceData buildSlice(const std::vector<Coordinate>& config);
+
+    /** \brief Append one C-slice to the roadmap and offset its vertex
+     * indices
+     * \param slice SliceData structure */
+    void mergeSlice(const SliceData& slice);
+
     void sampleOrientations() override;
 
     void connectMultiSlice() override;
@@ -38,6 +95,9 @@ class ProbHRM3D : public HRM3D {
 
     void setTransform(const std::vector<Coordinate>& v) override;
 
+    void setPathBridgeSlice(const std::vector<Coordinate>& v1,
+                            const std::vector<Coordinate>& v2) override;
+
     /** \brief Compute Tightly-Fitted Ellipsoid (TFE) to enclose robot parts
      * when rotating around its center
      * \param v1 Start rotational configuration (orientation of base and joint
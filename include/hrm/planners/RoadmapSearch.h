@@ -0,0 +1,169 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "PlanningResult.h"
+#include "hrm/datastructure/DataType.h"
+
+#include <vector>
+
+namespace hrm {
+namespace planners {
+
+/** \brief Result of one roadmap query */
+struct RoadmapSearchResult {
+    /** \brief Status of solution */
+    bool solved = false;
+
+    /** \brief Index list of vertices from source to target */
+    std::vector<Index> path;
+
+    /** \brief Total cost of the path */
+    double cost = 0.0;
+
+    /** \brief Number of vertices expanded during the search */
+    Index numExpansion = 0;
+};
+
+/** \brief Landmarks of ALT search and their distances to all the vertices */
+struct LandmarkTable {
+    /** \brief Indices of landmarks */
+    std::vector<Index> landmarks;
+
+    /** \brief Distances from each landmark to all the vertices */
+    std::vector<std::vector<double>> dist;
+
+    /** \brief Number of vertices when the landmarks were selected */
+    Index numVertexSelected = 0;
+
+    /** \brief Number of edges covered by the distances */
+    Index numEdge = 0;
+};
+
+/** \class RoadmapSearch
+ * \brief Shortest path queries on a roadmap graph, with A*, bidirectional A*,
+ * ALT (A*, landmarks and triangle inequality) and weighted A* strategies. The
+ * Euclidean distance between configurations is used as the base heuristic */
+class RoadmapSearch {
+  public:
+    /** \brief Constructor
+     * \param graph Roadmap graph structure, edges are undirected */
+    RoadmapSearch(const Graph& graph);
+
+    /** \brief Constructor sharing landmarks with searches on earlier versions
+     * of a roadmap that only grows
+     * \param graph Roadmap graph structure, edges are undirected
+     * \param landmark Landmark table, kept valid by updateLandmarks */
+    RoadmapSearch(const Graph& graph, LandmarkTable& landmark);
+
+    ~RoadmapSearch();
+
+    /** \brief Not copyable, since the landmark table in use may be owned by
+     * this instance */
+    RoadmapSearch(const RoadmapSearch&) = delete;
+    RoadmapSearch& operator=(const RoadmapSearch&) = delete;
+
+    /** \brief Select landmarks and precompute their distances to all the
+     * vertices, required by the ALT strategy. Should be called after the
+     * roadmap is finished, since new edges invalidate the distances
+     * \param numLandmark Number of landmarks */
+    void computeLandmarks(const Index numLandmark);
+
+    /** \brief Bring the landmark table up to date with the roadmap. Since
+     * vertices and edges are only appended, the distances are repaired from
+     * the new edges. Landmarks are selected again once the number of vertices
+     * has grown by LANDMARK_REFRESH_RATIO, or if the roadmap has been
+     * replaced
+     * \param numLandmark Number of landmarks */
+    void updateLandmarks(const Index numLandmark);
+
+    /** \brief Search for the shortest path
+     * \param source Index of source vertex
+     * \param target Index of target vertex
+     * \param strategy Search strategy (0: A*; 1: bidirectional A*; 2: ALT; 3:
+     * weighted A*)
+     * \param weight Inflation factor of the heuristic for weighted A*, the
+     * path cost is bounded by weight times the optimal cost
+     * \return RoadmapSearchResult structure */
+    RoadmapSearchResult search(const Index source, const Index target,
+                               const Index strategy,
+                               const double weight = 1.0) const;
+
+    /** \brief Unidirectional A* with inflated heuristic
+     * \param source Index of source vertex
+     * \param target Index of target vertex
+     * \param weight Inflation factor of the heuristic
+     * \param useLandmark Whether to include landmark lower bounds
+     * \return RoadmapSearchResult structure */
+    RoadmapSearchResult searchAStar(const Index source, const Index target,
+                                    const double weight,
+                                    const bool useLandmark) const;
+
+    /** \brief Bidirectional A* with average consistent potentials
+     * \param source Index of source vertex
+     * \param target Index of target vertex
+     * \return RoadmapSearchResult structure */
+    RoadmapSearchResult searchBidirectional(const Index source,
+                                            const Index target) const;
+
+    /** \brief Get the indices of the selected landmarks */
+    const std::vector<Index>& getLandmarks() const {
+        return landmark_.landmarks;
+    }
+
+    /** \brief Growth ratio of the number of vertices to select landmarks
+     * again */
+    static constexpr double LANDMARK_REFRESH_RATIO = 2.0;
+
+  private:
+    /** \brief Lower bound of distance between two vertices
+     * \param u, v Indices of vertices
+     * \param useLandmark Whether to include landmark lower bounds
+     * \return Heuristic value */
+    double heuristic(const Index u, const Index v,
+                     const bool useLandmark) const;
+
+    /** \brief Single-source shortest distances
+     * \param source Index of source vertex
+     * \param dist Distances to all the vertices */
+    void dijkstra(const Index source, std::vector<double>& dist) const;
+
+    /** \brief Propagate decreased distances through the roadmap
+     * \param seeds Indices of vertices whose distances have decreased
+     * \param dist Distances to all the vertices, updated in place */
+    void propagateDistance(const std::vector<Index>& seeds,
+                           std::vector<double>& dist) const;
+
+    /** \brief Reconstruct path from predecessors of two directions
+     * \param source, target Indices of end vertices
+     * \param meet Index of vertex where path is joined
+     * \param predForward Predecessors in forward search
+     * \param predBackward Predecessors in backward search
+     * \param res RoadmapSearchResult storing the path, cost is assigned by
+     * the caller */
+    void tracePath(const Index source, const Index target, const Index meet,
+                   const std::vector<Index>& predForward,
+                   const std::vector<Index>& predBackward,
+                   RoadmapSearchResult& res) const;
+
+    /** \brief Reference to the roadmap */
+    const Graph& graph_;
+
+    /** \brief Offsets of adjacency lists, compressed sparse row format */
+    std::vector<Index> adjOffset_;
+
+    /** \brief Neighbor vertices of adjacency lists */
+    std::vector<Index> adjVertex_;
+
+    /** \brief Edge weights of adjacency lists */
+    std::vector<double> adjWeight_;
+
+    /** \brief Landmark table owned by this search */
+    LandmarkTable ownLandmark_;
+
+    /** \brief Landmark table in use, either owned or shared */
+    LandmarkTable& landmark_;
+};
+
+}  // namespace planners
+}  // namespace hrm
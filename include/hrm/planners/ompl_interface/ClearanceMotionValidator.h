@@ -0,0 +1,54 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include <ompl/base/MotionValidator.h>
+#include <ompl/base/SpaceInformation.h>
+
+#include <functional>
+
+namespace hrm {
+namespace planners {
+namespace ompl_interface {
+
+namespace ob = ompl::base;
+
+/** \brief Lower bound of the distance between the robot at a state and the
+ * obstacles, non-positive when the robot may be in collision */
+using ClearanceFn = std::function<double(const ob::State*)>;
+
+/** \class ClearanceMotionValidator
+ * \brief Motion validator that skips ahead along the motion using clearance.
+ * Since no point of the robot moves farther than displacementBound times the
+ * distance in state space, a state with clearance d certifies the motion
+ * segment of length d / displacementBound to be free. Falls back to the
+ * resolution of the state space when the clearance is smaller */
+class ClearanceMotionValidator : public ob::MotionValidator {
+  public:
+    /** \brief Constructor
+     * \param si Space information
+     * \param clearanceFn Function of clearance lower bound
+     * \param displacementBound Upper bound of displacement of any point on
+     * the robot per unit distance in state space */
+    ClearanceMotionValidator(const ob::SpaceInformationPtr& si,
+                             ClearanceFn clearanceFn,
+                             const double displacementBound);
+
+    ~ClearanceMotionValidator() override;
+
+    bool checkMotion(const ob::State* s1, const ob::State* s2) const override;
+
+    bool checkMotion(const ob::State* s1, const ob::State* s2,
+                     std::pair<ob::State*, double>& lastValid) const override;
+
+  private:
+    /** \brief Function of clearance lower bound */
+    ClearanceFn clearanceFn_;
+
+    /** \brief Upper bound of displacement of robot per unit state distance */
+    const double displacementBound_;
+};
+
+}  // namespace ompl_interface
+}  // namespace planners
+}  // namespace hrm
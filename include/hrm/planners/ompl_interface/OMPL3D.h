@@ -6,6 +6,7 @@
 #include "hrm/datastructure/FreeSpace3D.h"
 #include "hrm/datastructure/MultiBodyTree3D.h"
 #include "hrm/planners/PlanningRequest.h"
+#include "hrm/util/ObstacleCollisionManager.h"
 #include "hrm/util/Parse2dCsvFile.h"
 
 #include <ompl/base/spaces/SE3StateSpace.h>
@@ -46,6 +47,15 @@ class OMPL3D : public OMPLInterface<MultiBodyTree3D, SuperQuadrics> {
 
     bool isSeparated(const MultiBodyTree3D& robotAux) const override;
 
+    virtual bool computeBodyPoses(const ob::State* state,
+                                  BodyPoses& tfBody) const override;
+
+    bool isBodySeparated(const BodyPoses& tfBody) const override;
+
+    double computeClearance(const ob::State* state) const override;
+
+    double getDisplacementBound() const override;
+
     virtual void setStateFromVector(
         const std::vector<Coordinate>* stateVariables,
         ob::ScopedState<ob::CompoundStateSpace>* state) const override;
@@ -55,6 +65,15 @@ class OMPL3D : public OMPLInterface<MultiBodyTree3D, SuperQuadrics> {
 
     /** \brief Mesh type for obstacles */
     const std::vector<Mesh>& obsMesh_;
+
+    /** \brief Broad-phase collision manager for non-ellipsoidal obstacles */
+    ObstacleCollisionManager obsManager_;
+
+    /** \brief Ellipsoidal obstacles for batched separation tests */
+    EllipsoidBatch obsEllipsoid_;
+
+    /** \brief Semi-axes of robot bodies, base first */
+    std::vector<Eigen::Vector3d> semiAxisBody_;
 };
 
 }  // namespace ompl_interface
@@ -37,6 +37,14 @@ class OMPL3DArticulated : public OMPL3D {
 
     MultiBodyTree3D transformRobot(const ob::State* state) const override;
 
+    bool computeBodyPoses(const ob::State* state,
+                          BodyPoses& tfBody) const override;
+
+    /** \brief Displacement of links under joint motions is not bounded, so
+     * the discrete motion validator is always used
+     * \return Zero */
+    double getDisplacementBound() const override { return 0.0; }
+
     void setStateFromVector(
         const std::vector<Coordinate>* stateVariables,
         ob::ScopedState<ob::CompoundStateSpace>* state) const override;
@@ -50,6 +58,9 @@ class OMPL3DArticulated : public OMPL3D {
     /** \brief URDF file name */
     const std::string urdfFile_;
 
+    /** \brief Names of the link bodies in the URDF file */
+    std::vector<std::string> bodyName_;
+
     /** \brief Number of joints */
     Index numJoint_;
 
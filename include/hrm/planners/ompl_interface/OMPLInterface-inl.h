@@ -39,7 +39,8 @@ OMPLInterface<RobotType, ObjectType>::~OMPLInterface() = default;
 
 template <typename RobotType, typename ObjectType>
 void OMPLInterface<RobotType, ObjectType>::setup(
-    const Index plannerId, const Index validStateSamplerId) {
+    const Index plannerId, const Index validStateSamplerId,
+    const Index motionValidatorId) {
     // Setup state space
     setStateSpace(lowBound_, highBound_);
 
@@ -49,6 +50,7 @@ void OMPLInterface<RobotType, ObjectType>::setup(
     ss_->getSpaceInformation()->setStateValidityCheckingResolution(
         STATE_VALIDITY_RESOLUTION);
     setCollisionObject();
+    setMotionValidator(motionValidatorId);
 
     // Set planner and sampler
     setPlanner(plannerId);
@@ -164,9 +166,36 @@ void OMPLInterface<RobotType, ObjectType>::setValidStateSampler(
     ss_->setup();
 }
 
+template <typename RobotType, typename ObjectType>
+void OMPLInterface<RobotType, ObjectType>::setMotionValidator(
+    const Index motionValidatorId) {
+    // Discrete motion validator is set by default
+    if (motionValidatorId != 1) {
+        return;
+    }
+
+    const double displacementBound = getDisplacementBound();
+    if (displacementBound <= 0.0) {
+        OMPL_WARN("Clearance not provided, use discrete motion validator.");
+        return;
+    }
+
+    ss_->getSpaceInformation()->setMotionValidator(
+        std::make_shared<ClearanceMotionValidator>(
+            ss_->getSpaceInformation(),
+            [this](const ob::State *state) { return computeClearance(state); },
+            displacementBound));
+}
+
 template <typename RobotType, typename ObjectType>
 bool OMPLInterface<RobotType, ObjectType>::isStateValid(
     const ob::State *state) const {
+    // Poses are written into per-thread storage, no copy of the robot model
+    thread_local BodyPoses tfBody;
+    if (computeBodyPoses(state, tfBody)) {
+        return isBodySeparated(tfBody);
+    }
+
     return isSeparated(transformRobot(state));
 }
 
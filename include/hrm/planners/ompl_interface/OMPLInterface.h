@@ -2,9 +2,11 @@
 
 #pragma once
 
+#include "ClearanceMotionValidator.h"
 #include "hrm/datastructure/DataType.h"
 #include "hrm/util/EllipsoidSQCollisionFCL.h"
 #include "hrm/util/EllipsoidSeparation.h"
+#include "hrm/util/ObstacleCollisionManager.h"
 
 #include <ompl/base/StateSpace.h>
 #include <ompl/geometric/SimpleSetup.h>
@@ -85,8 +87,12 @@ class OMPLInterface {
      *  (0: PRM; 1: LazyPRM; 2: RRT; 3: RRT-Connect; 4: EST; 5: SBL; 6: KPIECE)
      * \param validStateSamplerId ID of the ValidStateSampler
      *  (0: uniform; 1: Gaussian; 2: obstacle-based, OB; 3: maximum-clearance,
-     * MC; 4: bridge-test, Bridge) */
-    void setup(const Index plannerId, const Index validStateSamplerId);
+     * MC; 4: bridge-test, Bridge)
+     * \param motionValidatorId ID of the MotionValidator
+     *  (0: discrete, fixed resolution; 1: clearance-based, skipping ahead by
+     * clearance when provided by the robot type) */
+    void setup(const Index plannerId, const Index validStateSamplerId,
+               const Index motionValidatorId = 0);
 
     /** \brief Start to plan
      * \param start Start configuration
@@ -119,13 +125,48 @@ class OMPLInterface {
      * \param validSamplerId Valid state sampler ID */
     void setValidStateSampler(const Index validSamplerId);
 
+    /** \brief Set the motion validator
+     * \param motionValidatorId Motion validator ID */
+    void setMotionValidator(const Index motionValidatorId);
+
     /** \brief Set the FCL collision object */
     virtual void setCollisionObject() = 0;
 
-    /** \brief Check collision
+    /** \brief Check collision. Safe to be called concurrently, and free of
+     * heap allocations when the robot body poses are provided
      * \param state ompl::base::State pointer */
     bool isStateValid(const ob::State* state) const;
 
+    /** \brief Compute poses of robot bodies without copying the robot model
+     * \param state ompl::base::State pointer
+     * \param tfBody Poses of robot bodies, base first
+     * \return false if not provided, then the robot model is transformed */
+    virtual bool computeBodyPoses(const ob::State* state,
+                                  BodyPoses& tfBody) const {
+        return false;
+    }
+
+    /** \brief Indication of separation between posed robot bodies and
+     * obstacles, only used when computeBodyPoses is provided
+     * \param tfBody Poses of robot bodies, base first
+     * \return Indicator, true for separated, false for collision */
+    virtual bool isBodySeparated(const BodyPoses& tfBody) const {
+        return false;
+    }
+
+    /** \brief Lower bound of distance between robot and obstacles, used by
+     * the clearance-based motion validator. Safe to be called concurrently
+     * \param state ompl::base::State pointer
+     * \return Clearance, non-positive when the robot may be in collision */
+    virtual double computeClearance(const ob::State* state) const {
+        return 0.0;
+    }
+
+    /** \brief Upper bound of displacement of any point on the robot per unit
+     * distance in state space
+     * \return Bound, non-positive if clearance is not provided */
+    virtual double getDisplacementBound() const { return 0.0; }
+
     /** \brief Transform the robot
      * \param state ompl::base::State pointer
      * \return Robot model after transformation */
@@ -170,7 +211,7 @@ class OMPLInterface {
     /** \brief FCL collision object for robot bodies */
     std::vector<fcl::CollisionObject<double>> objRobot_;
 
-    /** \brief FCL collision object for obstacles */
+    /** \brief FCL collision object for obstacles, posed at setup */
     std::vector<fcl::CollisionObject<double>> objObs_;
 
     /** \brief Planning results */
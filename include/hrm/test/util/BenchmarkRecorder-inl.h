@@ -0,0 +1,21 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "BenchmarkRecorder.h"
+
+namespace hrm {
+
+template <class OMPLPlanner>
+BenchmarkMetrics getOMPLPlanningMetrics(const OMPLPlanner& planner) {
+    return {{"SUCCESS", double(planner.isSolved())},
+            {"PLAN_TIME", planner.getPlanningTime()},
+            {"GRAPH_NODE", double(planner.getNumVertex())},
+            {"GRAPH_EDGE", double(planner.getNumEdges())},
+            {"PATH_NODE", double(planner.getPathLength())},
+            {"VALID_SPACE", planner.getValidStatePercent()},
+            {"N_COLLISION_CHECK", double(planner.getNumCollisionChecks())},
+            {"N_VALID_STATE", double(planner.getNumValidStates())}};
+}
+
+}  // namespace hrm
@@ -0,0 +1,104 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "hrm/planners/PlanningRequest.h"
+#include "hrm/planners/PlanningResult.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hrm {
+
+/** \brief Named metrics of one trial, in the order of output */
+using BenchmarkMetrics = std::vector<std::pair<std::string, double>>;
+
+/** \class BenchmarkRecorder
+ * \brief Records benchmark trials in a common JSON schema shared by all the
+ * benchmark programs. The file stores the build and machine information, the
+ * scene and planner parameters, the raw metrics of every trial and their
+ * distribution statistics, grouped by benchmark cases (e.g. planner and
+ * sampler combinations). Files can be compared by
+ * demo/python/compare_benchmarks.py */
+class BenchmarkRecorder {
+  public:
+    /** \brief Constructor, collects git revision, compiler, flags, CPU model,
+     * hardware threads, time stamp and random seed
+     * \param name Name of the benchmark program */
+    BenchmarkRecorder(const std::string& name);
+
+    ~BenchmarkRecorder();
+
+    /** \brief Set metadata entry, overwritten if the key exists
+     * \param key Name of the entry
+     * \param value Text value */
+    void setMetadata(const std::string& key, const std::string& value);
+
+    /** \brief Set numerical metadata entry, overwritten if the key exists
+     * \param key Name of the entry
+     * \param value Numerical value */
+    void setMetadata(const std::string& key, const double value);
+
+    /** \brief Record planner parameters
+     * \param param PlannerParameter structure */
+    void setParameters(const PlannerParameter& param);
+
+    /** \brief Add one trial
+     * \param caseName Name of the benchmark case
+     * \param metrics Metrics of the trial, the names should be the same for
+     * all trials of one case */
+    void addTrial(const std::string& caseName, const BenchmarkMetrics& metrics);
+
+    /** \brief Write the records into file
+     * \param filename Path of the JSON file */
+    void store(const std::string& filename) const;
+
+  private:
+    /** \brief Trials of one benchmark case */
+    struct BenchmarkCase {
+        std::string name;
+        std::vector<std::string> metricNames;
+        std::vector<std::vector<double>> trials;
+    };
+
+    /** \brief Set entry of JSON object, overwritten if the key exists
+     * \param object List of keys and JSON values
+     * \param key Name of the entry
+     * \param value JSON value */
+    static void setEntry(
+        std::vector<std::pair<std::string, std::string>>& object,
+        const std::string& key, const std::string& value);
+
+    /** \brief Name of the benchmark */
+    std::string name_;
+
+    /** \brief Metadata entries, values in JSON format */
+    std::vector<std::pair<std::string, std::string>> metadata_;
+
+    /** \brief Planner parameters, values in JSON format */
+    std::vector<std::pair<std::string, std::string>> parameters_;
+
+    /** \brief Benchmark cases in the order of first trial */
+    std::vector<BenchmarkCase> cases_;
+};
+
+/** \brief Metrics of planning result shared by HRM-based benchmarks: status,
+ * time, final resolution, graph and path sizes, phase time and operation
+ * counts
+ * \param res PlanningResult structure
+ * \param param Planner parameters after planning
+ * \return BenchmarkMetrics */
+BenchmarkMetrics getPlanningMetrics(const PlanningResult& res,
+                                    const PlannerParameter& param);
+
+/** \brief Metrics of OMPL-based benchmarks: status, time, graph and path
+ * sizes, valid space and state counts
+ * \param planner Planner derived from OMPLInterface, after planning
+ * \return BenchmarkMetrics */
+template <class OMPLPlanner>
+BenchmarkMetrics getOMPLPlanningMetrics(const OMPLPlanner& planner);
+
+}  // namespace hrm
+
+#include "BenchmarkRecorder-inl.h"
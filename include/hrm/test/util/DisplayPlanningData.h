@@ -3,18 +3,43 @@
 #pragma once
 
 #include "hrm/planners/PlanningResult.h"
+#include "hrm/util/DataFileWriter.h"
 
+#include <ostream>
 #include <string>
 
 namespace hrm {
 
 void displayPlanningTimeInfo(const Time& time);
+void displayOperationCountInfo(const OperationCount& count);
+
+/** \brief Write column names of phase time and operation counts to benchmark
+ * files, each prefixed by a comma */
+void storeStatisticsHeader(std::ostream& file);
+
+/** \brief Write phase time and operation counts to benchmark files, in the
+ * same order as storeStatisticsHeader */
+void storeStatistics(const Time& time, const OperationCount& count,
+                     std::ostream& file);
 
 void displayGraphInfo(const Graph& graph);
-void storeGraphInfo(const Graph& graph, const std::string& dimension);
+
+/** \brief Store vertices and edges of the roadmap into data files
+ * \param graph Roadmap
+ * \param suffix Suffix of the file names
+ * \param format File format, .csv text or binary */
+void storeGraphInfo(const Graph& graph, const std::string& suffix,
+                    const DataFileFormat format = DataFileFormat::CSV);
 
 void displayPathInfo(const SolutionPathInfo& path);
-void storePathInfo(const SolutionPathInfo& path, const std::string& dimension);
+
+/** \brief Store vertex indices, configurations and interpolated poses of the
+ * solution path into data files
+ * \param path Solution path
+ * \param suffix Suffix of the file names
+ * \param format File format, .csv text or binary */
+void storePathInfo(const SolutionPathInfo& path, const std::string& suffix,
+                   const DataFileFormat format = DataFileFormat::CSV);
 
 template <class Planner>
 void storeRoutines(Planner& planner);
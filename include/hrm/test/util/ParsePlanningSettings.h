@@ -7,6 +7,7 @@
 #include "hrm/geometry/SuperEllipse.h"
 #include "hrm/geometry/SuperQuadrics.h"
 #include "hrm/planners/PlanningRequest.h"
+#include "hrm/util/Parse2dBinaryFile.h"
 #include "hrm/util/Parse2dCsvFile.h"
 
 namespace hrm {
@@ -63,7 +64,7 @@ MultiBodyTree3D loadRobotMultiBody3D(const std::string& pathPrefix,
                                      const std::string& quaternionFilename,
                                      const int numSurfPointParam);
 
-/** \brief Load pre-defined quaternion or generating uniform random SO(3)
+/** \brief Load pre-defined quaternion or generating uniform grid of SO(3)
  * rotations
  * \param quaternionFilename File path for the pre-defined Quaternions
  * \param robotBase SuperQuadrics object for the robot base */
@@ -151,7 +152,8 @@ class PlannerSetting {
         loadVectorGeometry(obstacleConfigFilename, numPointParam_, obstacle_);
 
         // Read end points config file
-        endPoints_ = parse2DCsvFile(pathPrefix + "end_points_" + dim_ + ".csv");
+        endPoints_ =
+            parse2DDataFile(pathPrefix + "end_points_" + dim_ + ".csv");
     }
 
   protected:
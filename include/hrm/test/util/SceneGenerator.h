@@ -0,0 +1,80 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "hrm/datastructure/DataType.h"
+
+#include <string>
+#include <vector>
+
+namespace hrm {
+
+/** \brief Parameters for procedural planning scenes */
+struct SceneParameter {
+    /** \brief Semi-axis lengths of the arena, {a, b} in 2D and {a, b, c} in
+     * 3D */
+    std::vector<double> arenaSemiAxis = {70.0, 40.0, 30.0};
+
+    /** \brief Number of random obstacles */
+    Index numObstacle = 10;
+
+    /** \brief Range of semi-axis lengths of random obstacles */
+    double minObstacleSize = 2.0;
+    double maxObstacleSize = 10.0;
+
+    /** \brief Number of walls perpendicular to x-axis between start and
+     * goal, each with one narrow passage */
+    Index numPassage = 0;
+
+    /** \brief Width of the passages */
+    double passageWidth = 10.0;
+
+    /** \brief Thickness of the walls */
+    double wallThickness = 2.0;
+
+    /** \brief Radius of balls around start and goal free of obstacles */
+    double endPointClearance = 8.0;
+
+    /** \brief Seed of the random number generator. The same seed produces
+     * the same scene on all platforms */
+    unsigned int seed = 1;
+};
+
+/** \brief Planning scene in the format of resource files. Each row of arena
+ * and obstacle is {semi-axes, exponents, center, rotation}; each row of end
+ * points is {center, rotation}. Rotations are stored as axis-angle in 3D and
+ * angle in 2D */
+struct SceneDescription {
+    std::vector<std::vector<double>> arena;
+    std::vector<std::vector<double>> obstacle;
+    std::vector<std::vector<double>> endPoints;
+};
+
+/** \brief Generate 3D scene of superquadric obstacles. Walls of box-like
+ * superquadrics are placed between start and goal, with one square passage
+ * per wall. Random obstacles are rejected if they block the walls or the
+ * neighborhood of start and goal, the scene may contain less obstacles than
+ * required if too crowded
+ * \param param SceneParameter structure
+ * \return SceneDescription */
+SceneDescription generateScene3D(const SceneParameter& param);
+
+/** \brief Generate 2D scene of superelliptic obstacles, in the same way as
+ * the 3D version
+ * \param param SceneParameter structure
+ * \return SceneDescription */
+SceneDescription generateScene2D(const SceneParameter& param);
+
+/** \brief Store scene into resource files, loadable by parsePlanningConfig
+ * with the map type being the scene name. The end points are padded with
+ * zero joint angles for articulated robots
+ * \param scene SceneDescription structure
+ * \param objectType Type of the object ("superquadrics" or "superellipse")
+ * \param sceneName Name of the scene, used as map type
+ * \param dim Dimension of the scene ("2D" or "3D")
+ * \param path Folder of the resource files */
+void storeScene(const SceneDescription& scene, const std::string& objectType,
+                const std::string& sceneName, const std::string& dim,
+                const std::string& path);
+
+}  // namespace hrm
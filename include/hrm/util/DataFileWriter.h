@@ -0,0 +1,106 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace hrm {
+
+/** \brief Format of data files for dumping graphs and paths */
+enum class DataFileFormat {
+    /** \brief Comma-separated text, numbers in shortest round-trip form */
+    CSV,
+
+    /** \brief Dense binary matrix: a magic string "HRMMAT01", the number of
+     * rows, the number of columns and the type of entries (0 for double, 1
+     * for 32-bit unsigned integer) as 64-bit unsigned integers, followed by
+     * all the entries in row-major and native byte order */
+    BINARY
+};
+
+/** \brief Extension of data files, including the dot
+ * \param format File format
+ * \return ".csv" or ".bin" */
+std::string getDataFileExtension(const DataFileFormat format);
+
+/** \class DataFileWriter
+ * \brief Streaming writer of tables of numbers. Rows are formatted into a
+ * large buffer, which is written to the file when full. In binary format,
+ * all the rows must have the same size and type, and the number of rows is
+ * written when closing */
+class DataFileWriter {
+  public:
+    /** \brief Constructor, opens the file
+     * \param filename Name of the file
+     * \param format File format
+     * \param bufferSize Size of the buffer in bytes */
+    DataFileWriter(const std::string& filename, const DataFileFormat format,
+                   const size_t bufferSize = 1 << 20);
+
+    /** \brief Destructor, closes the file */
+    ~DataFileWriter();
+
+    DataFileWriter(const DataFileWriter&) = delete;
+    DataFileWriter& operator=(const DataFileWriter&) = delete;
+
+    /** \brief Append a row
+     * \param row Pointer to the numbers
+     * \param size Number of entries */
+    void writeRow(const double* row, const size_t size);
+
+    /** \brief Append a row
+     * \param row Numbers in the row */
+    void writeRow(const std::vector<double>& row) {
+        writeRow(row.data(), row.size());
+    }
+
+    /** \brief Append a row of indices, e.g. edges of graphs
+     * \param row Pointer to the indices
+     * \param size Number of entries */
+    void writeRow(const std::uint32_t* row, const size_t size);
+
+    /** \brief Flush the buffer, complete the header and close the file */
+    void close();
+
+    /** \brief Number of rows written */
+    size_t getNumRow() const { return numRow_; }
+
+  private:
+    /** \brief Append a row of entries in any type
+     * \param type Type code of entries in binary format */
+    template <typename T>
+    void writeEntries(const T* row, const size_t size,
+                      const std::uint64_t type);
+
+    /** \brief Write the buffer to the file */
+    void flush();
+
+    /** \brief File stream */
+    std::ofstream file_;
+
+    /** \brief Name of the file, for error messages */
+    std::string filename_;
+
+    /** \brief File format */
+    DataFileFormat format_;
+
+    /** \brief Buffer of formatted rows */
+    std::vector<char> buffer_;
+
+    /** \brief Number of bytes used in the buffer */
+    size_t bufferUsed_ = 0;
+
+    /** \brief Number of rows */
+    size_t numRow_ = 0;
+
+    /** \brief Number of columns, binary format only */
+    size_t numCol_ = 0;
+
+    /** \brief Type code of entries, binary format only */
+    std::uint64_t type_ = 0;
+};
+
+}  // namespace hrm
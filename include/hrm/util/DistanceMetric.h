@@ -2,9 +2,11 @@
 
 #pragma once
 
+#include "hrm/datastructure/Configuration.h"
 #include "hrm/datastructure/DataType.h"
 
 #include <cmath>
+#include <functional>
 #include <numeric>
 #include <vector>
 
@@ -15,4 +17,12 @@ using Distance = double;
 Distance vectorEuclidean(const std::vector<Coordinate>& v1,
                          const std::vector<Coordinate>& v2);
 
+/** \brief Euclidean distance between configurations, unrolled for
+ * compile-time dimensions */
+template <int Dim>
+Distance configurationEuclidean(const Configuration<Dim>& v1,
+                                const Configuration<Dim>& v2) {
+    return (v1 - v2).norm();
+}
+
 }  // namespace hrm
@@ -7,8 +7,60 @@
 
 #include <Eigen/Dense>
 
+#include <array>
+#include <vector>
+
 namespace hrm {
 
+/** \brief Batch of ellipsoids in structure-of-arrays form, with quantities
+ * precomputed for separation tests against a moving ellipsoid */
+struct EllipsoidBatch {
+    /** \brief x-coordinates of centers */
+    std::vector<double> centerX;
+
+    /** \brief y-coordinates of centers */
+    std::vector<double> centerY;
+
+    /** \brief z-coordinates of centers */
+    std::vector<double> centerZ;
+
+    /** \brief Radius of bounding spheres, i.e. largest semi-axis */
+    std::vector<double> radiusOuter;
+
+    /** \brief Radius of inscribed spheres, i.e. smallest semi-axis */
+    std::vector<double> radiusInner;
+
+    /** \brief Upper triangle of quadric matrix in world frame, i.e.
+     * inv(T)' * diag(a^-2, b^-2, c^-2, -1) * inv(T), stored row-wise */
+    std::array<std::vector<double>, 10> quadric;
+
+    /** \brief Number of ellipsoids */
+    std::size_t size() const { return centerX.size(); }
+};
+
+/** \brief Precompute batch of ellipsoids for separation tests
+ * \param ellipsoids List of ellipsoids as SuperQuadrics with unit exponents
+ * \return EllipsoidBatch structure */
+EllipsoidBatch getEllipsoidBatch(const std::vector<SuperQuadrics>& ellipsoids);
+
+/** \brief Separation test of one ellipsoid against a batch of ellipsoids.
+ * Bounding and inscribed spheres are compared first, and the algebraic
+ * separation condition is only evaluated for the undecided pairs
+ * \param semiAxisA Semi-axes of the ellipsoid
+ * \param poseA Pose of the ellipsoid as homogeneous transformation
+ * \param ellipsoidsB Batch of ellipsoids
+ * \return true if separated from all the ellipsoids in the batch */
+bool isEllipsoidSeparated(const Eigen::Vector3d& semiAxisA,
+                          const Eigen::Matrix4d& poseA,
+                          const EllipsoidBatch& ellipsoidsB);
+
+/** \brief Separation test of one ellipsoid against a batch of ellipsoids
+ * \param ellipsoidA Ellipsoid as SuperQuadrics with unit exponents
+ * \param ellipsoidsB Batch of ellipsoids
+ * \return true if separated from all the ellipsoids in the batch */
+bool isEllipsoidSeparated(const SuperQuadrics& ellipsoidA,
+                          const EllipsoidBatch& ellipsoidsB);
+
 bool isEllipsoidSeparated(const SuperQuadrics& ellipsoidA,
                           const SuperQuadrics& ellipsoidB);
 
@@ -0,0 +1,48 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "InterpolateSE3.h"
+
+namespace hrm {
+
+template <int Dim>
+void interpolateCompoundSE3Rn(const Configuration<Dim>& vStart,
+                              const Configuration<Dim>& vEnd,
+                              const Index numStep,
+                              ConfigurationList<Dim>& vInterp) {
+    // Linear interpolation for translation and joint angles
+    interpolateRn(vStart, vEnd, numStep, vInterp);
+
+    // Spherical linear interpolation for rotation
+    const Eigen::Quaterniond quatStart(vStart[3], vStart[4], vStart[5],
+                                       vStart[6]);
+    const Eigen::Quaterniond quatEnd(vEnd[3], vEnd[4], vEnd[5], vEnd[6]);
+
+    const double dt = 1.0 / static_cast<double>(vInterp.size() - 1);
+    for (size_t i = 0; i < vInterp.size(); ++i) {
+        const Eigen::Quaterniond quatStep =
+            quatStart.slerp(static_cast<double>(i) * dt, quatEnd);
+        vInterp[i][3] = quatStep.w();
+        vInterp[i][4] = quatStep.x();
+        vInterp[i][5] = quatStep.y();
+        vInterp[i][6] = quatStep.z();
+    }
+}
+
+template <int Dim>
+void interpolateRn(const Configuration<Dim>& vStart,
+                   const Configuration<Dim>& vEnd, const Index numStep,
+                   ConfigurationList<Dim>& vInterp) {
+    // At least the two end configurations
+    const Index numInterp = numStep == 0 ? 2 : numStep + 1;
+    vInterp.resize(numInterp, vStart);
+
+    const double dt = 1.0 / static_cast<double>(numInterp - 1);
+    for (size_t i = 0; i < numInterp; ++i) {
+        const double t = static_cast<double>(i) * dt;
+        vInterp[i] = (1.0 - t) * vStart + t * vEnd;
+    }
+}
+
+}  // namespace hrm
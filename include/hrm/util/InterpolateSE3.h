@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "hrm/datastructure/Configuration.h"
 #include "hrm/datastructure/DataType.h"
 
 #include <Eigen/Geometry>
@@ -38,4 +39,29 @@ std::vector<std::vector<Coordinate>> interpolateRn(
     const std::vector<Coordinate>& vStart, const std::vector<Coordinate>& vEnd,
     const Index numStep);
 
+/** \brief interpolateCompoundSE3Rn SE(3)xR^n compound interpolation on
+ * configuration types, the storage of interpolated sequence is reused
+ * \param vStart Start configuration
+ * \param vEnd Goal configuration
+ * \param numStep Number of interpolation steps
+ * \param vInterp Interpolated sequence with (numStep + 1) configurations */
+template <int Dim>
+void interpolateCompoundSE3Rn(const Configuration<Dim>& vStart,
+                              const Configuration<Dim>& vEnd,
+                              const Index numStep,
+                              ConfigurationList<Dim>& vInterp);
+
+/** \brief interpolateRn R^n linear interpolation on configuration types, the
+ * storage of interpolated sequence is reused
+ * \param vStart Start configuration
+ * \param vEnd Goal configuration
+ * \param numStep Number of interpolation steps
+ * \param vInterp Interpolated sequence with (numStep + 1) configurations */
+template <int Dim>
+void interpolateRn(const Configuration<Dim>& vStart,
+                   const Configuration<Dim>& vEnd, const Index numStep,
+                   ConfigurationList<Dim>& vInterp);
+
 }  // namespace hrm
+
+#include "InterpolateSE3-inl.h"
@@ -0,0 +1,75 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include <fcl/fcl.h>
+
+#include <Eigen/StdVector>
+#include <memory>
+#include <vector>
+
+namespace hrm {
+
+/** \brief Poses of all the robot bodies, base first */
+using BodyPoses =
+    std::vector<fcl::Transform3d, Eigen::aligned_allocator<fcl::Transform3d>>;
+
+/** \class ObstacleCollisionManager
+ * \brief Collision queries between robot bodies and static obstacles.
+ * Obstacles are registered once in a dynamic AABB tree, so that only the
+ * obstacles overlapping with bounding box of the query body are checked by
+ * narrow phase */
+class ObstacleCollisionManager {
+  public:
+    ObstacleCollisionManager();
+
+    ~ObstacleCollisionManager();
+
+    /** \brief Register static obstacles, replacing the previous ones
+     * \param objObs FCL collision objects of posed obstacles, should not be
+     * moved or destroyed while being registered */
+    void setObstacles(std::vector<fcl::CollisionObject<double>>& objObs);
+
+    /** \brief Register static obstacles, replacing the previous ones
+     * \param objObs Pointers to FCL collision objects of posed obstacles */
+    void setObstacles(const std::vector<fcl::CollisionObject<double>*>& objObs);
+
+    /** \brief Collision query of one body, safe to be called concurrently
+     * \param geometry Collision geometry of the body
+     * \param tf Pose of the body
+     * \return true if in collision with any obstacle, false otherwise */
+    bool isCollision(
+        const std::shared_ptr<fcl::CollisionGeometry<double>>& geometry,
+        const fcl::Transform3d& tf) const;
+
+    /** \brief Continuous collision query of one body moving between two
+     * poses, with rotation and translation interpolated linearly. Safe to be
+     * called concurrently
+     * \param geometry Collision geometry of the body
+     * \param tfStart Start pose of the body
+     * \param tfGoal Goal pose of the body
+     * \return true if in collision at any time of the motion, false
+     * otherwise */
+    bool isContinuousCollision(
+        const std::shared_ptr<fcl::CollisionGeometry<double>>& geometry,
+        const fcl::Transform3d& tfStart, const fcl::Transform3d& tfGoal) const;
+
+    /** \brief Minimum distance between one body and the obstacles, safe to
+     * be called concurrently
+     * \param geometry Collision geometry of the body
+     * \param tf Pose of the body
+     * \return Distance, 0 if in collision, infinity if no obstacle is
+     * registered */
+    double getDistance(
+        const std::shared_ptr<fcl::CollisionGeometry<double>>& geometry,
+        const fcl::Transform3d& tf) const;
+
+    /** \brief Get the number of registered obstacles */
+    std::size_t getNumObstacles() const { return manager_->size(); }
+
+  private:
+    /** \brief Broad-phase manager of obstacles */
+    std::unique_ptr<fcl::DynamicAABBTreeCollisionManager<double>> manager_;
+};
+
+}  // namespace hrm
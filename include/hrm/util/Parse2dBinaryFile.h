@@ -0,0 +1,40 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace hrm {
+
+/** \brief Parse a binary table of numbers by memory-mapping the file. The
+ * format is a magic string "HRMBIN01", the number of rows and the number of
+ * entries in each row as 64-bit unsigned integers, followed by all the
+ * entries as doubles, in native byte order. Dense matrices written by
+ * DataFileWriter are also accepted
+ * \param filename Name of the binary file
+ * \return Rows of numbers */
+std::vector<std::vector<double>> parse2DBinaryFile(const std::string& filename);
+
+/** \brief Write a table of numbers into the binary format
+ * \param data Rows of numbers
+ * \param filename Name of the binary file */
+void write2DBinaryFile(const std::vector<std::vector<double>>& data,
+                       const std::string& filename);
+
+/** \brief Name of the binary file paired with a .csv file
+ * \param filename Name of the .csv file
+ * \return Name with the extension replaced by .bin */
+std::string getBinaryFilename(const std::string& filename);
+
+/** \brief Convert a .csv file into the binary format, stored next to it
+ * \param filename Name of the .csv file */
+void convertCsvToBinary(const std::string& filename);
+
+/** \brief Parse a table of numbers, using the binary file paired with the
+ * .csv file if it exists and is not older, otherwise the .csv file
+ * \param filename Name of the .csv or binary file
+ * \return Rows of numbers */
+std::vector<std::vector<double>> parse2DDataFile(const std::string& filename);
+
+}  // namespace hrm
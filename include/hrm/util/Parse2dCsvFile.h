@@ -7,6 +7,10 @@
 
 namespace hrm {
 
+/** \brief Parse a .csv file of numbers in double precision, lines starting
+ * with '#' and empty lines are skipped
+ * \param filename Name of the .csv file
+ * \return Rows of numbers */
 std::vector<std::vector<double>> parse2DCsvFile(const std::string& filename);
 
 }
@@ -31,7 +31,7 @@ class ParseURDF {
      * \param bodyName The name of body to be retrieved
      * \return hrm::SE3Tranform homogeneous transformation matrix */
     hrm::SE3Transform getTransform(const KDL::JntArray& jointConfig,
-                                   const std::string& bodyName);
+                                   const std::string& bodyName) const;
 
   private:
     /** \brief KDL::Tree object */
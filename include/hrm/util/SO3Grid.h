@@ -0,0 +1,27 @@
+/** \author Sipu Ruan */
+
+#pragma once
+
+#include "hrm/datastructure/DataType.h"
+
+#include <Eigen/Geometry>
+
+#include <vector>
+
+namespace hrm {
+
+/** \brief Deterministic low-dispersion samples of SO(3) at any size, from
+ * the super-Fibonacci spiral in unit quaternions
+ * \param num Number of orientations
+ * \return List of unit quaternions */
+std::vector<Eigen::Quaterniond> generateSO3Grid(const Index num);
+
+/** \brief Nearest neighbors of each orientation in a list, by angular
+ * distance
+ * \param quat List of orientations
+ * \param k Number of neighbors, at most quat.size() - 1
+ * \return Indices of the neighbors for each orientation, from the nearest */
+std::vector<std::vector<Index>> getSO3NearestNeighbors(
+    const std::vector<Eigen::Quaterniond>& quat, const Index k);
+
+}  // namespace hrm
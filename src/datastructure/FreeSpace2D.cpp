@@ -18,6 +18,7 @@ void hrm::FreeSpace2D::computeIntersectionInterval(
         for (auto j = 0; j < cSpaceBoundary_.arena.size(); ++j) {
             const auto intersectPointArena = intersectHorizontalLinePolygon2D(
                 tLine.at(0).at(i), cSpaceBoundary_.arena.at(j));
+            numRayCast_++;
             if (intersectPointArena.empty()) {
                 intersect_.arenaLow.at(i).at(j) = lowBound_;
                 intersect_.arenaUpp.at(i).at(j) = upBound_;
@@ -30,21 +31,10 @@ void hrm::FreeSpace2D::computeIntersectionInterval(
                     std::fmax(intersectPointArena[0], intersectPointArena[1]));
             }
         }
-
-        // Intersections btw sweep line and obstacles
-        for (auto j = 0; j < cSpaceBoundary_.obstacle.size(); ++j) {
-            const auto intersectPointObstacle =
-                intersectHorizontalLinePolygon2D(
-                    tLine.at(0).at(i), cSpaceBoundary_.obstacle.at(j));
-            if (intersectPointObstacle.empty()) {
-                intersect_.obstacleLow.at(i).at(j) = NAN;
-                intersect_.obstacleUpp.at(i).at(j) = NAN;
-            } else {
-                intersect_.obstacleLow.at(i).at(j) = std::fmin(
-                    intersectPointObstacle[0], intersectPointObstacle[1]);
-                intersect_.obstacleUpp.at(i).at(j) = std::fmax(
-                    intersectPointObstacle[0], intersectPointObstacle[1]);
-            }
-        }
     }
+
+    // Intersections btw sweep lines and obstacles, all lines in one scan
+    intersectHorizontalLinesPolygons2D(
+        tLine.at(0), cSpaceBoundary_.obstacle, intersect_.obstacleLow,
+        intersect_.obstacleUpp, &numRayCast_);
 }
@@ -3,6 +3,8 @@
 #include "hrm/datastructure/FreeSpace3D.h"
 #include "hrm/geometry/LineIntersection.h"
 
+#include <algorithm>
+
 hrm::FreeSpace3D::FreeSpace3D(const MultiBodyTree3D& robot,
                               const std::vector<SuperQuadrics>& arena,
                               const std::vector<SuperQuadrics>& obstacle)
@@ -24,43 +26,109 @@ void hrm::FreeSpace3D::computeCSpaceBoundaryMesh(const BoundaryInfo& bound) {
         cSpaceBoundaryMesh_.obstacle.at(i) = getMeshFromParamSurface(
             bound.obstacle.at(i), obstacle_.at(0).getNumParam());
     }
+
+    computeObstacleBoundingBox();
+}
+
+void hrm::FreeSpace3D::setCSpaceBoundaryMesh(const BoundaryMesh& mesh) {
+    cSpaceBoundaryMesh_ = mesh;
+    computeObstacleBoundingBox();
+}
+
+void hrm::FreeSpace3D::computeObstacleBoundingBox() {
+    const auto numObstacle = cSpaceBoundaryMesh_.obstacle.size();
+    std::vector<Coordinate> lowX(numObstacle);
+    std::vector<Coordinate> uppX(numObstacle);
+    obstacleLowY_.resize(numObstacle);
+    obstacleUppY_.resize(numObstacle);
+
+    for (size_t i = 0; i < numObstacle; ++i) {
+        const auto& vertices = cSpaceBoundaryMesh_.obstacle.at(i).vertices;
+        lowX[i] = vertices.row(0).minCoeff();
+        uppX[i] = vertices.row(0).maxCoeff();
+        obstacleLowY_[i] = vertices.row(1).minCoeff();
+        obstacleUppY_[i] = vertices.row(1).maxCoeff();
+    }
+
+    obstacleTreeX_.build(lowX, uppX);
 }
 
 void hrm::FreeSpace3D::computeIntersectionInterval(
     const std::vector<std::vector<Coordinate>>& tLine) {
-    for (auto i = 0; i < tLine.at(1).size(); ++i) {
+    computeIntersectionInterval(tLine.at(0).back(), tLine.at(1), intersect_,
+                                numRayCast_, numTriangleTest_);
+}
+
+void hrm::FreeSpace3D::computeIntersectionInterval(
+    const Coordinate tx, const std::vector<Coordinate>& ty,
+    SweepLineWorkspace& workspace) const {
+    computeIntersectionInterval(tx, ty, workspace.intersect,
+                                workspace.numRayCast,
+                                workspace.numTriangleTest);
+}
+
+void hrm::FreeSpace3D::computeIntersectionInterval(
+    const Coordinate tx, const std::vector<Coordinate>& ty,
+    IntersectionInterval& intersect, Index& numRayCast,
+    Index& numTriangleTest) const {
+    // C-obstacles overlapping the plane of sweep lines
+    std::vector<Index> candidate;
+    obstacleTreeX_.query(tx, candidate);
+
+    std::vector<Coordinate> candidateLowY;
+    std::vector<Coordinate> candidateUppY;
+    for (const auto j : candidate) {
+        candidateLowY.push_back(obstacleLowY_.at(j));
+        candidateUppY.push_back(obstacleUppY_.at(j));
+    }
+    IntervalTree candidateTreeY;
+    candidateTreeY.build(candidateLowY, candidateUppY);
+
+    std::vector<Index> overlap;
+    for (auto i = 0; i < ty.size(); ++i) {
         // Find intersections along each sweep line
         Line3D lineZ(6);
-        lineZ << tLine.at(0).back(), tLine.at(1).at(i), 0, 0, 0, 1;
+        lineZ << tx, ty.at(i), 0, 0, 0, 1;
 
         for (auto j = 0; j < cSpaceBoundary_.arena.size(); ++j) {
             const auto intersectPointArena = intersectVerticalLineMesh3D(
-                lineZ, cSpaceBoundaryMesh_.arena.at(j));
+                lineZ, cSpaceBoundaryMesh_.arena.at(j), &numTriangleTest);
+            numRayCast++;
 
             if (intersectPointArena.empty()) {
-                intersect_.arenaLow.at(i).at(j) = lowBound_;
-                intersect_.arenaUpp.at(i).at(j) = upBound_;
+                intersect.arenaLow.at(i).at(j) = lowBound_;
+                intersect.arenaUpp.at(i).at(j) = upBound_;
             } else {
-                intersect_.arenaLow.at(i).at(j) =
+                intersect.arenaLow.at(i).at(j) =
                     std::fmin(lowBound_, std::fmin(intersectPointArena[0](2),
                                                    intersectPointArena[1](2)));
-                intersect_.arenaUpp.at(i).at(j) =
+                intersect.arenaUpp.at(i).at(j) =
                     std::fmax(upBound_, std::fmax(intersectPointArena[0](2),
                                                   intersectPointArena[1](2)));
             }
         }
 
-        for (auto j = 0; j < cSpaceBoundary_.obstacle.size(); ++j) {
-            const auto intersectPointObstacle = intersectVerticalLineMesh3D(
-                lineZ, cSpaceBoundaryMesh_.obstacle.at(j));
+        // Only C-obstacles whose bounding boxes contain the sweep line are
+        // visited, the others have no intersections
+        std::fill(intersect.obstacleLow.at(i).begin(),
+                  intersect.obstacleLow.at(i).end(), NAN);
+        std::fill(intersect.obstacleUpp.at(i).begin(),
+                  intersect.obstacleUpp.at(i).end(), NAN);
 
-            if (intersectPointObstacle.empty()) {
-                intersect_.obstacleLow.at(i).at(j) = NAN;
-                intersect_.obstacleUpp.at(i).at(j) = NAN;
-            } else {
-                intersect_.obstacleLow.at(i).at(j) = std::fmin(
+        overlap.clear();
+        candidateTreeY.query(ty.at(i), overlap);
+        for (const auto k : overlap) {
+            const auto j = candidate.at(k);
+            const auto intersectPointObstacle =
+                intersectVerticalLineMeshFaces3D(
+                    lineZ, cSpaceBoundaryMesh_.obstacle.at(j),
+                    &numTriangleTest);
+            numRayCast++;
+
+            if (!intersectPointObstacle.empty()) {
+                intersect.obstacleLow.at(i).at(j) = std::fmin(
                     intersectPointObstacle[0](2), intersectPointObstacle[1](2));
-                intersect_.obstacleUpp.at(i).at(j) = std::fmax(
+                intersect.obstacleUpp.at(i).at(j) = std::fmax(
                     intersectPointObstacle[0](2), intersectPointObstacle[1](2));
             }
         }
@@ -0,0 +1,81 @@
+/** \author Sipu Ruan */
+
+#include "hrm/datastructure/IntervalTree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+hrm::IntervalTree::IntervalTree() = default;
+
+hrm::IntervalTree::~IntervalTree() = default;
+
+void hrm::IntervalTree::build(const std::vector<Coordinate>& low,
+                              const std::vector<Coordinate>& upp) {
+    std::vector<Index> order;
+    for (size_t i = 0; i < low.size(); ++i) {
+        if (!std::isnan(low[i]) && !std::isnan(upp.at(i))) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&low](const Index a, const Index b) {
+        return low[a] < low[b];
+    });
+
+    low_.resize(order.size());
+    upp_.resize(order.size());
+    id_ = order;
+    for (size_t i = 0; i < order.size(); ++i) {
+        low_[i] = low[order[i]];
+        upp_[i] = upp[order[i]];
+    }
+
+    maxUpp_.resize(order.size());
+    buildSubtree(0, order.size());
+}
+
+void hrm::IntervalTree::query(const Coordinate point,
+                              std::vector<Index>& result) const {
+    querySubtree(0, low_.size(), point, result);
+}
+
+hrm::Coordinate hrm::IntervalTree::buildSubtree(const Index begin,
+                                                const Index end) {
+    if (begin >= end) {
+        return -std::numeric_limits<Coordinate>::infinity();
+    }
+
+    // The middle element is the root of the subtree
+    const Index mid = begin + (end - begin) / 2;
+    maxUpp_[mid] = std::fmax(
+        upp_[mid],
+        std::fmax(buildSubtree(begin, mid), buildSubtree(mid + 1, end)));
+
+    return maxUpp_[mid];
+}
+
+void hrm::IntervalTree::querySubtree(const Index begin, const Index end,
+                                     const Coordinate point,
+                                     std::vector<Index>& result) const {
+    if (begin >= end) {
+        return;
+    }
+
+    // No interval in the subtree reaches the point
+    const Index mid = begin + (end - begin) / 2;
+    if (maxUpp_[mid] < point) {
+        return;
+    }
+
+    querySubtree(begin, mid, point, result);
+
+    // Intervals on the right start after the point
+    if (low_[mid] > point) {
+        return;
+    }
+
+    if (upp_[mid] >= point) {
+        result.push_back(id_[mid]);
+    }
+    querySubtree(mid + 1, end, point, result);
+}
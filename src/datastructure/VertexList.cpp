@@ -0,0 +1,192 @@
+/** \author Sipu Ruan */
+
+#include "hrm/datastructure/VertexList.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+hrm::VertexList::VertexList() = default;
+
+hrm::VertexList::VertexList(
+    const std::vector<std::vector<Coordinate>>& vertex) {
+    for (const auto& v : vertex) {
+        push_back(v);
+    }
+}
+
+hrm::VertexList::VertexList(
+    std::initializer_list<std::vector<Coordinate>> vertex) {
+    for (const auto& v : vertex) {
+        push_back(v);
+    }
+}
+
+hrm::VertexList::~VertexList() = default;
+
+void hrm::VertexList::setLayout(const Index dim) {
+    dim_ = dim;
+    if (dim_ == 3) {
+        gridAxis_ = {0, 1};
+        lineAxis_ = 2;
+    } else if (dim_ == 2) {
+        gridAxis_ = {1};
+        lineAxis_ = 0;
+    } else {
+        dim_ = 0;
+        gridAxis_.clear();
+    }
+
+    grid_.assign(gridAxis_.size(), std::vector<Coordinate>());
+    gridIdx_.assign(gridAxis_.size(),
+                    std::unordered_map<Coordinate, std::uint32_t>());
+    shape_.clear();
+    shapeIdx_.clear();
+    clear();
+}
+
+void hrm::VertexList::clear() {
+    code_.clear();
+    exception_.clear();
+}
+
+void hrm::VertexList::push_back(const std::vector<Coordinate>& v) {
+    // Vertices off the layout are kept in full
+    if (dim_ == 0 || v.size() < dim_ || !std::isfinite(v.at(lineAxis_))) {
+        pushException(v);
+        return;
+    }
+
+    Code code{EXCEPTION, {0, 0}, 0.0f};
+
+    for (size_t k = 0; k < gridAxis_.size(); ++k) {
+        code.grid[k] = getGridIndex(k, v.at(gridAxis_.at(k)));
+    }
+    code.z = static_cast<float>(v.at(lineAxis_));
+
+    const auto shape = shapeIdx_.emplace(
+        std::vector<Coordinate>(v.begin() + dim_, v.end()),
+        static_cast<std::uint32_t>(shape_.size()));
+    if (shape.second) {
+        shape_.push_back(shape.first->first);
+    }
+    code.shape = shape.first->second;
+
+    code_.push_back(code);
+}
+
+void hrm::VertexList::pushException(const std::vector<Coordinate>& v) {
+    code_.push_back({EXCEPTION,
+                     {static_cast<std::uint32_t>(exception_.size()), 0},
+                     0.0f});
+    exception_.push_back(v);
+}
+
+void hrm::VertexList::append(const VertexList& other) {
+    code_.reserve(code_.size() + other.size());
+    std::vector<Coordinate> v;
+    for (size_t i = 0; i < other.size(); ++i) {
+        other.decode(i, v);
+        if (other.code_[i].shape == EXCEPTION) {
+            pushException(v);
+        } else {
+            push_back(v);
+        }
+    }
+}
+
+std::vector<hrm::Coordinate> hrm::VertexList::operator[](
+    const Index i) const {
+    std::vector<Coordinate> v;
+    decode(i, v);
+    return v;
+}
+
+std::vector<hrm::Coordinate> hrm::VertexList::at(const Index i) const {
+    if (i >= code_.size()) {
+        throw std::out_of_range("VertexList: index out of range");
+    }
+
+    return operator[](i);
+}
+
+void hrm::VertexList::decode(const Index i, std::vector<Coordinate>& v) const {
+    const Code& code = code_[i];
+    if (code.shape == EXCEPTION) {
+        v = exception_[code.grid[0]];
+        return;
+    }
+
+    const auto& shape = shape_[code.shape];
+    v.resize(dim_ + shape.size());
+    for (size_t k = 0; k < gridAxis_.size(); ++k) {
+        v[gridAxis_[k]] = grid_[k][code.grid[k]];
+    }
+    v[lineAxis_] = static_cast<Coordinate>(code.z);
+    std::copy(shape.begin(), shape.end(), v.begin() + dim_);
+}
+
+hrm::Coordinate hrm::VertexList::getCoordinate(const Index i,
+                                               const Index k) const {
+    const Code& code = code_[i];
+    if (code.shape == EXCEPTION) {
+        return exception_[code.grid[0]].at(k);
+    }
+
+    if (k >= dim_) {
+        return shape_[code.shape].at(k - dim_);
+    }
+    if (k == lineAxis_) {
+        return static_cast<Coordinate>(code.z);
+    }
+
+    const Index axis = std::find(gridAxis_.begin(), gridAxis_.end(), k) -
+                       gridAxis_.begin();
+    return grid_[axis][code.grid[axis]];
+}
+
+double hrm::VertexList::getDistance(const Index i, const Index j) const {
+    const Code& code1 = code_[i];
+    const Code& code2 = code_[j];
+
+    // Shapes at the same C-slice do not contribute
+    const Index numCoordinate =
+        (code1.shape != EXCEPTION && code1.shape == code2.shape)
+            ? dim_
+            : (code1.shape == EXCEPTION ? exception_[code1.grid[0]].size()
+                                        : dim_ + shape_[code1.shape].size());
+
+    double dist = 0.0;
+    for (size_t k = 0; k < numCoordinate; ++k) {
+        const double d = getCoordinate(i, k) - getCoordinate(j, k);
+        dist += d * d;
+    }
+
+    return std::sqrt(dist);
+}
+
+hrm::Index hrm::VertexList::getMemorySize() const {
+    Index size = code_.capacity() * sizeof(Code);
+    for (const auto& v : exception_) {
+        size += sizeof(v) + v.capacity() * sizeof(Coordinate);
+    }
+    for (const auto& shape : shape_) {
+        size += sizeof(shape) + shape.capacity() * sizeof(Coordinate);
+    }
+    for (const auto& grid : grid_) {
+        size += grid.capacity() * sizeof(Coordinate);
+    }
+
+    return size;
+}
+
+std::uint32_t hrm::VertexList::getGridIndex(const Index axis,
+                                            const Coordinate value) {
+    const auto grid = gridIdx_.at(axis).emplace(
+        value, static_cast<std::uint32_t>(grid_.at(axis).size()));
+    if (grid.second) {
+        grid_.at(axis).push_back(value);
+    }
+
+    return grid.first->second;
+}
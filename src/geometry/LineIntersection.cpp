@@ -2,7 +2,10 @@
 
 #include "hrm/geometry/LineIntersection.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <numeric>
 
 std::vector<Eigen::Vector3d> hrm::intersectLineMesh3D(const Line3D& line,
                                                       const MeshMatrix& shape) {
@@ -32,11 +35,12 @@ std::vector<Eigen::Vector3d> hrm::intersectLineMesh3D(const Line3D& line,
     Eigen::Vector3d v;
     Eigen::Vector3d pt;
 
-    for (auto i = 0; i < shape.faces.rows(); ++i) {
+    const MeshFaces& faces = *shape.faces;
+    for (Eigen::Index i = 0; i < faces.rows(); ++i) {
         // find triangle edge vectors
-        t0 = shape.vertices.col(int(shape.faces(i, 0)));
-        u = shape.vertices.col(int(shape.faces(i, 1))) - t0;
-        v = shape.vertices.col(int(shape.faces(i, 2))) - t0;
+        t0 = shape.vertices.col(faces(i, 0));
+        u = shape.vertices.col(faces(i, 1)) - t0;
+        v = shape.vertices.col(faces(i, 2)) - t0;
 
         // keep only interesting points
         bool hasIntersect = intersectLineTriangle3D(line, t0, u, v, pt);
@@ -54,7 +58,7 @@ std::vector<Eigen::Vector3d> hrm::intersectLineMesh3D(const Line3D& line,
 }
 
 std::vector<Eigen::Vector3d> hrm::intersectVerticalLineMesh3D(
-    const Line3D& line, const MeshMatrix& shape) {
+    const Line3D& line, const MeshMatrix& shape, Index* numTriangleTest) {
     std::vector<Point3D> points;
 
     if (line(0) > shape.vertices.row(0).maxCoeff() ||
@@ -66,6 +70,13 @@ std::vector<Eigen::Vector3d> hrm::intersectVerticalLineMesh3D(
         return points;
     }
 
+    return intersectVerticalLineMeshFaces3D(line, shape, numTriangleTest);
+}
+
+std::vector<Eigen::Vector3d> hrm::intersectVerticalLineMeshFaces3D(
+    const Line3D& line, const MeshMatrix& shape, Index* numTriangleTest) {
+    std::vector<Point3D> points;
+
     Eigen::Vector3d t0;
     Eigen::Vector3d u;
     Eigen::Vector3d v;
@@ -76,40 +87,36 @@ std::vector<Eigen::Vector3d> hrm::intersectVerticalLineMesh3D(
      * according to x and y coord: If the x or y coordinates of the vertical
      * sweep line is out of range of the triangle, directly ignore
      */
-    for (auto i = 0; i < shape.faces.rows(); ++i) {
+    const MeshFaces& faces = *shape.faces;
+    for (Eigen::Index i = 0; i < faces.rows(); ++i) {
         // ignore the face that is out of range
-        if (line(0) <
-                std::fmin(
-                    shape.vertices(0, int(shape.faces(i, 0))),
-                    std::fmin(shape.vertices(0, int(shape.faces(i, 1))),
-                              shape.vertices(0, int(shape.faces(i, 2))))) ||
-            line(0) >
-                std::fmax(
-                    shape.vertices(0, int(shape.faces(i, 0))),
-                    std::fmax(shape.vertices(0, int(shape.faces(i, 1))),
-                              shape.vertices(0, int(shape.faces(i, 2)))))) {
+        if (line(0) < std::fmin(shape.vertices(0, faces(i, 0)),
+                                std::fmin(shape.vertices(0, faces(i, 1)),
+                                          shape.vertices(0, faces(i, 2)))) ||
+            line(0) > std::fmax(shape.vertices(0, faces(i, 0)),
+                                std::fmax(shape.vertices(0, faces(i, 1)),
+                                          shape.vertices(0, faces(i, 2))))) {
             continue;
         }
-        if (line(1) <
-                std::fmin(
-                    shape.vertices(1, int(shape.faces(i, 0))),
-                    std::fmin(shape.vertices(1, int(shape.faces(i, 1))),
-                              shape.vertices(1, int(shape.faces(i, 2))))) ||
-            line(1) >
-                std::fmax(
-                    shape.vertices(1, int(shape.faces(i, 0))),
-                    std::fmax(shape.vertices(1, int(shape.faces(i, 1))),
-                              shape.vertices(1, int(shape.faces(i, 2)))))) {
+        if (line(1) < std::fmin(shape.vertices(1, faces(i, 0)),
+                                std::fmin(shape.vertices(1, faces(i, 1)),
+                                          shape.vertices(1, faces(i, 2)))) ||
+            line(1) > std::fmax(shape.vertices(1, faces(i, 0)),
+                                std::fmax(shape.vertices(1, faces(i, 1)),
+                                          shape.vertices(1, faces(i, 2))))) {
             continue;
         }
 
         // find triangle edge vectors
-        t0 = shape.vertices.col(int(shape.faces(i, 0)));
-        u = shape.vertices.col(int(shape.faces(i, 1))) - t0;
-        v = shape.vertices.col(int(shape.faces(i, 2))) - t0;
+        t0 = shape.vertices.col(faces(i, 0));
+        u = shape.vertices.col(faces(i, 1)) - t0;
+        v = shape.vertices.col(faces(i, 2)) - t0;
 
         // keep only interesting points
         bool hasIntersect = intersectLineTriangle3D(line, t0, u, v, pt);
+        if (numTriangleTest != nullptr) {
+            (*numTriangleTest)++;
+        }
 
         if (hasIntersect) {
             points.push_back(pt);
@@ -172,39 +179,32 @@ bool hrm::intersectLineTriangle3D(const Line3D& line, const Eigen::Vector3d& t0,
 
 bool hrm::isIntersectSegPolygon2D(
     const std::pair<std::vector<double>, std::vector<double>>& seg,
-    const Eigen::Matrix2Xd& shape) {
-    double px1 = seg.first.at(0);
-    double py1 = seg.first.at(1);
-    double px2 = seg.second.at(0);
-    double py2 = seg.second.at(1);
-
-    Eigen::Matrix2d A;
-    A(0, 0) = px2 - px1;
-    A(1, 0) = py2 - py1;
-
-    Eigen::Vector2d b;
+    const BoundaryPoints& shape) {
+    const double px1 = seg.first.at(0);
+    const double py1 = seg.first.at(1);
+    const double px2 = seg.second.at(0);
+    const double py2 = seg.second.at(1);
+
+    // Sides of all the polygon vertices w.r.t. the line of the segment
+    const Eigen::ArrayXd side =
+        ((px2 - px1) * (shape.row(1).array() - py1) -
+         (py2 - py1) * (shape.row(0).array() - px1))
+            .sign();
 
     for (auto i = 0; i < shape.cols(); ++i) {
-        double x1 = shape(0, i);
-        double y1 = shape(1, i);
-        double x2 = shape(0, 0);
-        double y2 = shape(1, 0);
+        const auto j = (i == shape.cols() - 1) ? 0 : i + 1;
 
-        if (i != shape.cols() - 1) {
-            x2 = shape(0, i + 1);
-            y2 = shape(1, i + 1);
+        // Edge strictly crosses the line of the segment
+        if (side(i) * side(j) >= 0.0) {
+            continue;
         }
 
-        // compute line segments intersection
-        A(0, 1) = x1 - x2;
-        A(1, 1) = y1 - y2;
-
-        b(0) = x1 - px1;
-        b(1) = y1 - py1;
-
-        Eigen::Vector2d sol = A.colPivHouseholderQr().solve(b);
-
-        if ((sol(0) > 0 && sol(0) < 1) && (sol(1) > 0 && sol(1) < 1)) {
+        // Segment end points are strictly on both sides of the edge
+        const double ex = shape(0, j) - shape(0, i);
+        const double ey = shape(1, j) - shape(1, i);
+        const double s1 = ex * (py1 - shape(1, i)) - ey * (px1 - shape(0, i));
+        const double s2 = ex * (py2 - shape(1, i)) - ey * (px2 - shape(0, i));
+        if ((s1 > 0.0 && s2 < 0.0) || (s1 < 0.0 && s2 > 0.0)) {
             return true;
         }
     }
@@ -212,6 +212,39 @@ bool hrm::isIntersectSegPolygon2D(
     return false;
 }
 
+bool hrm::isIntersectSegBox2D(
+    const std::pair<std::vector<double>, std::vector<double>>& seg,
+    const Eigen::AlignedBox2d& box) {
+    const Eigen::Vector2d p1(seg.first.at(0), seg.first.at(1));
+    const Eigen::Vector2d p2(seg.second.at(0), seg.second.at(1));
+
+    // Bounding box of the segment
+    if (!box.intersects(Eigen::AlignedBox2d(p1.cwiseMin(p2),
+                                            p1.cwiseMax(p2)))) {
+        return false;
+    }
+
+    // Line of the segment separates the box
+    const Eigen::Vector2d direction = p2 - p1;
+    bool hasPositive = false;
+    bool hasNegative = false;
+    for (const auto corner :
+         {Eigen::AlignedBox2d::BottomLeft, Eigen::AlignedBox2d::BottomRight,
+          Eigen::AlignedBox2d::TopLeft, Eigen::AlignedBox2d::TopRight}) {
+        const Eigen::Vector2d v = box.corner(corner) - p1;
+        const double side = direction(0) * v(1) - direction(1) * v(0);
+        hasPositive = hasPositive || side >= 0.0;
+        hasNegative = hasNegative || side <= 0.0;
+    }
+
+    return hasPositive && hasNegative;
+}
+
+Eigen::AlignedBox2d hrm::getBoundingBox2D(const BoundaryPoints& shape) {
+    return Eigen::AlignedBox2d(shape.rowwise().minCoeff(),
+                               shape.rowwise().maxCoeff());
+}
+
 std::vector<double> hrm::intersectHorizontalLinePolygon2D(
     const double ty, const Eigen::Matrix2Xd& shape) {
     std::vector<double> points;
@@ -246,3 +279,113 @@ std::vector<double> hrm::intersectHorizontalLinePolygon2D(
 
     return points;
 }
+
+void hrm::intersectHorizontalLinesPolygons2D(
+    const std::vector<double>& ty, const std::vector<BoundaryPoints>& shapes,
+    std::vector<std::vector<double>>& low,
+    std::vector<std::vector<double>>& upp, Index* numQuery) {
+    /** \brief Polygon edge from vertex id to the next one */
+    struct Edge {
+        Index shape;
+        Index id;
+        double yMin;
+        double yMax;
+    };
+
+    // Edge table sorted by lower y-coordinates
+    std::vector<Edge> edges;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        const auto& shape = shapes.at(i);
+        for (auto j = 0; j < shape.cols(); ++j) {
+            const auto k = (j == shape.cols() - 1) ? 0 : j + 1;
+            edges.push_back({i, static_cast<Index>(j),
+                             std::fmin(shape(1, j), shape(1, k)),
+                             std::fmax(shape(1, j), shape(1, k))});
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+        return a.yMin < b.yMin;
+    });
+
+    std::vector<Index> lineOrder(ty.size());
+    std::iota(lineOrder.begin(), lineOrder.end(), 0);
+    std::sort(lineOrder.begin(), lineOrder.end(),
+              [&ty](const Index a, const Index b) { return ty[a] < ty[b]; });
+
+    // Only the crossings of the first two edges along the boundary of each
+    // polygon are kept, as in intersectHorizontalLinePolygon2D
+    const Index noLine = ty.size();
+    std::vector<Index> lineStamp(shapes.size(), noLine);
+    std::vector<Index> numCross(shapes.size(), 0);
+    std::vector<std::pair<Index, double>> firstCross(shapes.size());
+    std::vector<std::pair<Index, double>> secondCross(shapes.size());
+
+    std::vector<Index> active;
+    std::vector<Index> touched;
+    size_t nextEdge = 0;
+    for (const auto i : lineOrder) {
+        const double y = ty[i];
+        std::fill(low.at(i).begin(), low.at(i).end(), NAN);
+        std::fill(upp.at(i).begin(), upp.at(i).end(), NAN);
+
+        // Update active edge table
+        while (nextEdge < edges.size() && edges[nextEdge].yMin <= y) {
+            active.push_back(nextEdge++);
+        }
+
+        touched.clear();
+        for (size_t k = 0; k < active.size();) {
+            const Edge& edge = edges[active[k]];
+            if (edge.yMax < y) {
+                active[k] = active.back();
+                active.pop_back();
+                continue;
+            }
+            ++k;
+
+            if (lineStamp[edge.shape] != i) {
+                lineStamp[edge.shape] = i;
+                numCross[edge.shape] = 0;
+                touched.push_back(edge.shape);
+            }
+
+            // compute line-line segment intersection
+            const auto& shape = shapes[edge.shape];
+            const auto j = static_cast<Eigen::Index>(edge.id);
+            const auto next = (j == shape.cols() - 1) ? 0 : j + 1;
+            const double t =
+                (y - shape(1, next)) / (shape(1, j) - shape(1, next));
+            if (!(t >= 0.0 && t <= 1.0)) {
+                continue;
+            }
+
+            const std::pair<Index, double> cross(
+                edge.id, t * shape(0, j) + (1.0 - t) * shape(0, next));
+            auto& first = firstCross[edge.shape];
+            auto& second = secondCross[edge.shape];
+            if (numCross[edge.shape] == 0 || cross.first < first.first) {
+                second = first;
+                first = cross;
+            } else if (numCross[edge.shape] == 1 ||
+                       cross.first < second.first) {
+                second = cross;
+            }
+            numCross[edge.shape]++;
+        }
+
+        for (const auto j : touched) {
+            if (numQuery != nullptr) {
+                (*numQuery)++;
+            }
+            if (numCross[j] == 0) {
+                continue;
+            }
+
+            // A single crossing touches the polygon at one point
+            const double x0 = firstCross[j].second;
+            const double x1 = numCross[j] == 1 ? x0 : secondCross[j].second;
+            low.at(i).at(j) = std::fmin(x0, x1);
+            upp.at(i).at(j) = std::fmax(x0, x1);
+        }
+    }
+}
@@ -1,13 +1,17 @@
 /** \authors Sipu Ruan, Karen L. Poblete */
 
 #include "hrm/geometry/MeshGenerator.h"
+#include "hrm/util/ExponentialFunction.h"
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Triangulation_3.h>
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -16,14 +20,55 @@ using K = CGAL::Exact_predicates_inexact_constructions_kernel;
 using Triangulation = CGAL::Triangulation_3<K>;
 
 hrm::Mesh hrm::getMeshFromSQ(const SuperQuadrics& sq) {
-    const SuperQuadrics sqAux(sq.getSemiAxis(), sq.getEpsilon(),
-                              {0.0, 0.0, 0.0}, Eigen::Quaterniond::Identity(),
-                              sq.getNumParam());
+    // Interior rings of latitude (eta) and sectors of longitude (omega), the
+    // two poles are single vertices so that the surface is closed
+    const auto numSector =
+        static_cast<int>(std::max<Index>(sq.getNumParam(), 3));
+    const int numRing = numSector - 2;
+    const auto& a = sq.getSemiAxis();
+    const auto& eps = sq.getEpsilon();
 
-    Mesh M;
-    ParametricPoints pts = getBoundary3D(sqAux);
-    M = getMesh(pts);
-    return M;
+    Mesh res;
+    res.vertices.reserve(numRing * numSector + 2);
+    for (int k = 0; k < numRing; ++k) {
+        const double eta = -HALF_PI + PI * static_cast<double>(k + 1) /
+                                          static_cast<double>(numSector - 1);
+        const double cosEta = exponentialFunction(eta, eps.at(0), false);
+        const double sinEta = exponentialFunction(eta, eps.at(0), true);
+
+        for (int l = 0; l < numSector; ++l) {
+            const double omega = -PI + 2.0 * PI * static_cast<double>(l) /
+                                           static_cast<double>(numSector);
+            res.vertices.emplace_back(
+                a.at(0) * cosEta *
+                    exponentialFunction(omega, eps.at(1), false),
+                a.at(1) * cosEta * exponentialFunction(omega, eps.at(1), true),
+                a.at(2) * sinEta);
+        }
+    }
+    const int south = static_cast<int>(res.vertices.size());
+    res.vertices.emplace_back(0.0, 0.0, -a.at(2));
+    const int north = static_cast<int>(res.vertices.size());
+    res.vertices.emplace_back(0.0, 0.0, a.at(2));
+
+    // Triangles with outward normals, wrapped around the longitude
+    auto vertexId = [numSector](const int k, const int l) {
+        return k * numSector + (l % numSector);
+    };
+    res.triangles.reserve(2 * numSector * (numSector - 2));
+    for (int l = 0; l < numSector; ++l) {
+        res.triangles.emplace_back(south, vertexId(0, l + 1), vertexId(0, l));
+        for (int k = 0; k < numRing - 1; ++k) {
+            res.triangles.emplace_back(vertexId(k, l), vertexId(k, l + 1),
+                                       vertexId(k + 1, l + 1));
+            res.triangles.emplace_back(vertexId(k, l), vertexId(k + 1, l + 1),
+                                       vertexId(k + 1, l));
+        }
+        res.triangles.emplace_back(north, vertexId(numRing - 1, l),
+                                   vertexId(numRing - 1, l + 1));
+    }
+
+    return res;
 }
 
 hrm::Mesh hrm::getMesh(const ParametricPoints& points) {
@@ -102,30 +147,42 @@ hrm::ParametricPoints hrm::getBoundaryFromMatrix(const BoundaryPoints& ptsMat) {
     return X;
 }
 
-hrm::MeshMatrix hrm::getMeshFromParamSurface(const BoundaryPoints& surfBound,
+hrm::MeshMatrix hrm::getMeshFromParamSurface(BoundaryPoints surfBound,
                                              const Index n) {
-    const auto numVtx = static_cast<Eigen::Index>(n);
-    const auto numSurfVtx = (numVtx - 1) * (numVtx - 1);
+    MeshMatrix M;
+    M.vertices = std::move(surfBound);
+    M.faces = getParamSurfaceFaces(n);
 
-    Eigen::ArrayXd q(numSurfVtx);
-    for (auto i = 0; i < n - 1; ++i) {
-        auto currIdx = static_cast<Eigen::Index>(i);
+    return M;
+}
+
+std::shared_ptr<const hrm::MeshFaces> hrm::getParamSurfaceFaces(
+    const Index n) {
+    // Faces of each resolution, shared by all the meshes
+    static std::map<Index, std::shared_ptr<const MeshFaces>> facesAll;
+    static std::mutex facesMutex;
 
-        q.segment(currIdx * (numVtx - 1), (numVtx - 1)) =
-            Eigen::ArrayXd::LinSpaced(
-                numVtx - 1, static_cast<double>(currIdx * numVtx),
-                static_cast<double>((currIdx + 1) * numVtx - 2));
+    std::lock_guard<std::mutex> lock(facesMutex);
+    auto& facesShared = facesAll[n];
+    if (facesShared) {
+        return facesShared;
     }
 
-    MeshMatrix M;
-    M.vertices = surfBound;
-    M.faces = Eigen::MatrixXd::Zero(2 * numSurfVtx, 3);
-    M.faces.block(0, 0, numSurfVtx, 1) = q;
-    M.faces.block(0, 1, numSurfVtx, 1) = q + numVtx;
-    M.faces.block(0, 2, numSurfVtx, 1) = q + numVtx + 1;
-    M.faces.block(numSurfVtx, 0, numSurfVtx, 1) = q;
-    M.faces.block(numSurfVtx, 1, numSurfVtx, 1) = q + 1;
-    M.faces.block(numSurfVtx, 2, numSurfVtx, 1) = q + numVtx + 1;
+    // Two triangles for each cell of the grid
+    const auto numVtx = static_cast<int>(n);
+    const auto numSurfVtx = (numVtx - 1) * (numVtx - 1);
 
-    return M;
+    auto faces = std::make_shared<MeshFaces>(2 * numSurfVtx, 3);
+    for (int i = 0; i < numVtx - 1; ++i) {
+        for (int j = 0; j < numVtx - 1; ++j) {
+            const int row = i * (numVtx - 1) + j;
+            const int q = i * numVtx + j;
+
+            faces->row(row) << q, q + numVtx, q + numVtx + 1;
+            faces->row(numSurfVtx + row) << q, q + 1, q + numVtx + 1;
+        }
+    }
+
+    facesShared = faces;
+    return facesShared;
 }
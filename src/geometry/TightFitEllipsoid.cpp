@@ -3,41 +3,99 @@
 #include "hrm/geometry/TightFitEllipsoid.h"
 #include "hrm/util/InterpolateSE3.h"
 
-hrm::SuperEllipse hrm::getMVCE2D(const std::vector<double>& a,
-                                 const std::vector<double>& b,
-                                 const double thetaA, const double thetaB,
-                                 const Index num) {
-    const Eigen::Matrix2d Ra = Eigen::Rotation2Dd(thetaA).matrix();
-    const Eigen::Matrix2d Rb = Eigen::Rotation2Dd(thetaB).matrix();
-
-    const double r = fmin(b[0], b[1]);
-    Eigen::DiagonalMatrix<double, 2> diag;
-    Eigen::DiagonalMatrix<double, 2> diagA;
-    Eigen::DiagonalMatrix<double, 2> diagC;
-    diag.diagonal() = Eigen::Array2d(r / b[0], r / b[1]);
-    diagA.diagonal() = Eigen::Array2d(pow(a[0], -2), pow(a[1], -2));
-
-    // Shrinking affine transformation
-    Eigen::Matrix2d T = Rb * diag * Rb.transpose();
+#include <cmath>
+
+namespace {
+
+/** \brief Semi-axes and orientation of an ellipsoid centered at origin */
+template <int Dim>
+struct Ellipsoid {
+    Eigen::Matrix<double, Dim, 1> semiAxis;
+    Eigen::Matrix<double, Dim, Dim> rotation;
+};
+
+/** \brief Minimum volume concentric ellipsoid that encloses ellipsoids A and
+ * B. The matrices are symmetric, so the eigen-decompositions are computed in
+ * closed form
+ * \param a Semi-axes of A
+ * \param b Semi-axes of B
+ * \param Ra Orientation of A
+ * \param Rb Orientation of B
+ * \return Semi-axes in ascending order and orientation of the MVCE */
+template <int Dim>
+Ellipsoid<Dim> computeMVCE(const Eigen::Matrix<double, Dim, 1>& a,
+                           const Eigen::Matrix<double, Dim, 1>& b,
+                           const Eigen::Matrix<double, Dim, Dim>& Ra,
+                           const Eigen::Matrix<double, Dim, Dim>& Rb) {
+    using Vector = Eigen::Matrix<double, Dim, 1>;
+    using Matrix = Eigen::Matrix<double, Dim, Dim>;
+
+    const double r = b.minCoeff();
+
+    // Shrinking affine transformation and its inverse
+    const Vector diag = r * b.cwiseInverse();
+    const Matrix T = Rb * diag.asDiagonal() * Rb.transpose();
+    const Matrix TInv = Rb * diag.cwiseInverse().asDiagonal() * Rb.transpose();
 
     // In shrunk space, fit ellipsoid Cp to sphere Bp and ellipsoid Ap
-    Eigen::Matrix2d aPrimeMatrix =
-        T.inverse() * (Ra * diagA * Ra.transpose()) * T.inverse();
-    Eigen::JacobiSVD<Eigen::Matrix2d> svd(
-        aPrimeMatrix, Eigen::ComputeFullU | Eigen::ComputeFullV);
-    const Eigen::Array2d aPrime = svd.singularValues().array().pow(-0.5);
-    const Eigen::Array2d cPrime = {std::max(aPrime(0), r),
-                                   std::max(aPrime(1), r)};
+    const Vector diagA = a.array().pow(-2.0);
+    const Matrix aPrimeMatrix =
+        TInv * Ra * diagA.asDiagonal() * Ra.transpose() * TInv;
+    Eigen::SelfAdjointEigenSolver<Matrix> solver;
+    solver.computeDirect(aPrimeMatrix);
+    const Vector cPrime =
+        solver.eigenvalues().array().pow(-0.5).max(r).matrix();
 
     // Stretch back
-    diagC.diagonal() = cPrime.pow(-2);
-    const Eigen::Matrix2d C =
-        T * svd.matrixU() * diagC * svd.matrixU().transpose() * T;
-    svd.compute(C);
-    const double angleC = acos(svd.matrixU()(0, 0));
-    const Eigen::Array2d c = svd.singularValues().array().pow(-0.5);
-
-    return SuperEllipse({c(0), c(1)}, 1, {0, 0}, angleC, num);
+    const Vector diagC = cPrime.array().pow(-2.0);
+    const Matrix C = T * solver.eigenvectors() * diagC.asDiagonal() *
+                     solver.eigenvectors().transpose() * T;
+    solver.computeDirect(C);
+
+    // Eigenvalues are in ascending order, i.e. semi-axes in descending order
+    Ellipsoid<Dim> mvce;
+    mvce.semiAxis = solver.eigenvalues().array().pow(-0.5).reverse();
+    mvce.rotation = solver.eigenvectors().rowwise().reverse();
+    if (mvce.rotation.determinant() < 0.0) {
+        mvce.rotation.col(0) *= -1.0;
+    }
+
+    return mvce;
+}
+
+Eigen::Vector2d toVector2d(const std::vector<double>& v) {
+    return {v.at(0), v.at(1)};
+}
+
+Eigen::Vector3d toVector3d(const std::vector<double>& v) {
+    return {v.at(0), v.at(1), v.at(2)};
+}
+
+hrm::SuperEllipse toSuperEllipse(const Ellipsoid<2>& ellipse,
+                                 const hrm::Index num) {
+    return hrm::SuperEllipse(
+        {ellipse.semiAxis(0), ellipse.semiAxis(1)}, 1, {0, 0},
+        std::atan2(ellipse.rotation(1, 0), ellipse.rotation(0, 0)), num);
+}
+
+hrm::SuperQuadrics toSuperQuadrics(const Ellipsoid<3>& ellipsoid,
+                                   const hrm::Index num) {
+    return hrm::SuperQuadrics(
+        {ellipsoid.semiAxis(0), ellipsoid.semiAxis(1), ellipsoid.semiAxis(2)},
+        {1, 1}, {0, 0, 0}, Eigen::Quaterniond(ellipsoid.rotation), num);
+}
+
+}  // namespace
+
+hrm::SuperEllipse hrm::getMVCE2D(const std::vector<double>& a,
+                                 const std::vector<double>& b,
+                                 const double thetaA, const double thetaB,
+                                 const Index num) {
+    return toSuperEllipse(
+        computeMVCE<2>(toVector2d(a), toVector2d(b),
+                       Eigen::Rotation2Dd(thetaA).matrix(),
+                       Eigen::Rotation2Dd(thetaB).matrix()),
+        num);
 }
 
 hrm::SuperQuadrics hrm::getMVCE3D(const std::vector<double>& a,
@@ -45,54 +103,32 @@ hrm::SuperQuadrics hrm::getMVCE3D(const std::vector<double>& a,
                                   const Eigen::Quaterniond& quatA,
                                   const Eigen::Quaterniond& quatB,
                                   const Index num) {
-    Eigen::Matrix3d Ra = quatA.toRotationMatrix();
-    Eigen::Matrix3d Rb = quatB.toRotationMatrix();
-
-    const double r = fmin(b[0], fmin(b[1], b[2]));
-    Eigen::DiagonalMatrix<double, 3> diag;
-    Eigen::DiagonalMatrix<double, 3> diagA;
-    Eigen::DiagonalMatrix<double, 3> diagC;
-    diag.diagonal() = Eigen::Array3d(r / b[0], r / b[1], r / b[2]);
-    diagA.diagonal() =
-        Eigen::Array3d(pow(a[0], -2.0), pow(a[1], -2.0), pow(a[2], -2.0));
-
-    // Shrinking affine transformation
-    const Eigen::Matrix3d T = Rb * diag * Rb.transpose();
-
-    // In shrunk space, fit ellipsoid Cp to sphere Bp and ellipsoid Ap
-    const Eigen::Matrix3d aPrimeMatrix =
-        T.inverse() * (Ra * diagA * Ra.transpose()) * T.inverse();
-    Eigen::JacobiSVD<Eigen::Matrix3d> svd(
-        aPrimeMatrix, Eigen::ComputeFullU | Eigen::ComputeFullV);
-    const Eigen::Array3d aPrime = svd.singularValues().array().pow(-0.5);
-    const Eigen::Array3d cPrime = {std::fmax(aPrime(0), r),
-                                   std::fmax(aPrime(1), r),
-                                   std::fmax(aPrime(2), r)};
-
-    // Stretch back
-    diagC.diagonal() = cPrime.pow(-2.0);
-    const Eigen::Matrix3d C =
-        T * svd.matrixU() * diagC * svd.matrixU().transpose() * T;
-    svd.compute(C);
-    const Eigen::Quaterniond quatC(svd.matrixU());
-    const Eigen::Array3d c = svd.singularValues().array().pow(-0.5);
-
-    return SuperQuadrics({c(0), c(1), c(2)}, {1, 1}, {0, 0, 0}, quatC, num);
+    return toSuperQuadrics(
+        computeMVCE<3>(toVector3d(a), toVector3d(b),
+                       quatA.toRotationMatrix(), quatB.toRotationMatrix()),
+        num);
 }
 
 hrm::SuperEllipse hrm::getTFE2D(const std::vector<double>& a,
                                 const double thetaA, const double thetaB,
                                 const Index numStep, const Index num) {
-    SuperEllipse enclosedEllipse = getMVCE2D(a, a, thetaA, thetaB, num);
+    // Iterate on semi-axes and orientations, the boundary parameters are only
+    // generated for the result
+    const Eigen::Vector2d semiAxis = toVector2d(a);
+    Ellipsoid<2> enclosedEllipse =
+        computeMVCE<2>(semiAxis, semiAxis, Eigen::Rotation2Dd(thetaA).matrix(),
+                       Eigen::Rotation2Dd(thetaB).matrix());
+
     const double dt = 1.0 / (static_cast<double>(numStep) - 1);
     for (auto i = 0; i < numStep; ++i) {
         auto currIdx = static_cast<double>(i);
         double thetaStep = (1 - currIdx * dt) * thetaA + currIdx * dt * thetaB;
-        enclosedEllipse = getMVCE2D(a, enclosedEllipse.getSemiAxis(), thetaStep,
-                                    enclosedEllipse.getAngle(), num);
+        enclosedEllipse = computeMVCE<2>(
+            semiAxis, enclosedEllipse.semiAxis,
+            Eigen::Rotation2Dd(thetaStep).matrix(), enclosedEllipse.rotation);
     }
 
-    return enclosedEllipse;
+    return toSuperEllipse(enclosedEllipse, num);
 }
 
 hrm::SuperQuadrics hrm::getTFE3D(const std::vector<double>& a,
@@ -103,12 +139,68 @@ hrm::SuperQuadrics hrm::getTFE3D(const std::vector<double>& a,
         interpolateSlerp(quatA, quatB, numStep);
 
     // Iteratively compute MVCE and update
-    SuperQuadrics enclosedEllipsoid = getMVCE3D(a, a, quatA, quatB, num);
+    const Eigen::Vector3d semiAxis = toVector3d(a);
+    Ellipsoid<3> enclosedEllipsoid =
+        computeMVCE<3>(semiAxis, semiAxis, quatA.toRotationMatrix(),
+                       quatB.toRotationMatrix());
     for (size_t i = 1; i < size_t(numStep); ++i) {
-        enclosedEllipsoid = getMVCE3D(a, enclosedEllipsoid.getSemiAxis(),
-                                      interpolatedQuat.at(i),
-                                      enclosedEllipsoid.getQuaternion(), num);
+        enclosedEllipsoid = computeMVCE<3>(
+            semiAxis, enclosedEllipsoid.semiAxis,
+            interpolatedQuat.at(i).toRotationMatrix(),
+            enclosedEllipsoid.rotation);
     }
 
-    return enclosedEllipsoid;
+    return toSuperQuadrics(enclosedEllipsoid, num);
+}
+
+hrm::TFECache::TFECache() = default;
+
+hrm::TFECache::~TFECache() = default;
+
+hrm::SuperEllipse hrm::TFECache::getTFE2D(const std::vector<double>& a,
+                                          const double thetaA,
+                                          const double thetaB,
+                                          const Index numStep,
+                                          const Index num) {
+    std::vector<double> key = a;
+    key.insert(key.end(), {thetaA, thetaB, double(numStep), double(num)});
+
+    const auto it = tfe2D_.find(key);
+    if (it != tfe2D_.end()) {
+        numHit_++;
+        return it->second;
+    }
+
+    return tfe2D_
+        .emplace(std::move(key),
+                 hrm::getTFE2D(a, thetaA, thetaB, numStep, num))
+        .first->second;
+}
+
+hrm::SuperQuadrics hrm::TFECache::getTFE3D(const std::vector<double>& a,
+                                           const Eigen::Quaterniond& quatA,
+                                           const Eigen::Quaterniond& quatB,
+                                           const Index numStep,
+                                           const Index num) {
+    std::vector<double> key = a;
+    key.insert(key.end(), quatA.coeffs().data(), quatA.coeffs().data() + 4);
+    key.insert(key.end(), quatB.coeffs().data(), quatB.coeffs().data() + 4);
+    key.insert(key.end(), {double(numStep), double(num)});
+
+    const auto it = tfe3D_.find(key);
+    if (it != tfe3D_.end()) {
+        numHit_++;
+        return it->second;
+    }
+
+    return tfe3D_
+        .emplace(std::move(key),
+                 hrm::getTFE3D(a, quatA, quatB, numStep, num))
+        .first->second;
+}
+
+void hrm::TFECache::clear() {
+    tfe2D_.clear();
+    tfe3D_.clear();
+    numHit_ = 0;
 }
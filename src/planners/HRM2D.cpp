@@ -3,6 +3,8 @@
 #include "hrm/planners/HRM2D.h"
 #include "hrm/geometry/LineIntersection.h"
 
+#include <cmath>
+
 hrm::planners::HRM2D::HRM2D(const MultiBodyTree2D& robot,
                             const std::vector<SuperEllipse>& arena,
                             const std::vector<SuperEllipse>& obs,
@@ -21,24 +23,38 @@ void hrm::planners::HRM2D::constructOneSlice(const Index sliceIdx) {
     // Set rotation matrix to robot
     setTransform({0.0, 0.0, headings_.at(sliceIdx)});
 
-    // Generate new C-slice
-    if (!isRefine_) {
+    // Generate new C-slice, or regenerate the released one in streaming mode
+    if (!isRefine_ || param_.isStreamingSlice) {
         // Generate Minkowski operation boundaries
+        const auto start = Clock::now();
         freeSpacePtr_->computeCSpaceBoundary();
         sliceBound_ = freeSpacePtr_->getCSpaceBoundary();
-        sliceBoundAll_.push_back(sliceBound_);
+        res_.planningTime.phaseTime.minkSumTime +=
+            Durationd(Clock::now() - start).count();
+        if (!param_.isStreamingSlice) {
+            sliceBoundAll_.push_back(sliceBound_);
+        }
     } else {
         sliceBound_ = sliceBoundAll_.at(sliceIdx);
     }
 
+    // Bounding boxes of C-obstacles for same-slice connections
+    sliceBoundBox_.clear();
+    for (const auto& obstacle : sliceBound_.obstacle) {
+        sliceBoundBox_.push_back(getBoundingBox2D(obstacle));
+    }
+
     // Sweep-line process to generate collision free line segments
     sweepLineProcess();
 
     // Generate collision-free vertices
+    const auto start = Clock::now();
     generateVertices(0.0, freeSegOneSlice_);
 
     // Connect vertices within one C-slice
     connectOneSlice2D(freeSegOneSlice_);
+    res_.planningTime.phaseTime.connectOneSliceTime +=
+        Durationd(Clock::now() - start).count();
 }
 
 /** \brief Setup rotation angles: angle range [-PI, PI]. If the heading
@@ -61,12 +77,21 @@ void hrm::planners::HRM2D::sweepLineProcess() {
     }
 
     // Find intersecting points to C-obstacles for each raster scan line
+    const Index numRayCast = freeSpacePtr_->getNumRayCast();
+    auto start = Clock::now();
     std::vector<std::vector<Coordinate>> tLine{ty};
     freeSpacePtr_->computeIntersectionInterval(tLine);
+    res_.planningTime.phaseTime.rayCastTime +=
+        Durationd(Clock::now() - start).count();
+    res_.operationCount.numRayCast +=
+        freeSpacePtr_->getNumRayCast() - numRayCast;
 
     // Compute collision-free intervals at each sweep line
+    start = Clock::now();
     freeSpacePtr_->computeFreeSegment(ty);
     freeSegOneSlice_ = freeSpacePtr_->getFreeSegment();
+    res_.planningTime.phaseTime.freeSegmentTime +=
+        Durationd(Clock::now() - start).count();
 }
 
 void hrm::planners::HRM2D::generateVertices(const Coordinate tx,
@@ -122,17 +147,21 @@ void hrm::planners::HRM2D::connectMultiSlice() {
         endIdAdj = vertexIdx_.at(j).slice;
 
         // Compute TFE and construct bridge C-slice
+        auto start = Clock::now();
         computeTFE(headings_[i], headings_[j], tfe_);
         bridgeSlice();
+        res_.planningTime.phaseTime.bridgeSliceTime +=
+            Durationd(Clock::now() - start).count();
 
         // Connect close vertices btw slices
+        start = Clock::now();
+        const auto& vertexList = res_.graphStructure.vertex;
         for (size_t m0 = startIdCur; m0 < endIdCur; ++m0) {
-            v1 = res_.graphStructure.vertex[m0];
+            vertexList.decode(m0, v1);
             for (size_t m1 = startIdAdj; m1 < endIdAdj; ++m1) {
-                v2 = res_.graphStructure.vertex[m1];
-
-                // Locate the neighbor vertices, check for validity
-                if (std::fabs(v1[1] - v2[1]) >
+                // Locate the neighbor vertices, check for validity. Only the
+                // adjacent ones are decoded
+                if (std::fabs(v1[1] - vertexList.getCoordinate(m1, 1)) >
                     distAdjacency *
                         std::fabs(param_.boundaryLimits[3] -
                                   param_.boundaryLimits[2]) /
@@ -140,6 +169,7 @@ void hrm::planners::HRM2D::connectMultiSlice() {
                     continue;
                 }
 
+                vertexList.decode(m1, v2);
                 if (isMultiSliceTransitionFree(v1, v2)) {
                     // Add new connections
                     res_.graphStructure.edge.push_back(std::make_pair(m0, m1));
@@ -152,6 +182,8 @@ void hrm::planners::HRM2D::connectMultiSlice() {
                 }
             }
         }
+        res_.planningTime.phaseTime.connectMultiSliceTime +=
+            Durationd(Clock::now() - start).count();
     }
 }
 
@@ -168,14 +200,15 @@ void hrm::planners::HRM2D::connectExistSlice(const Index sliceId) {
     // Locate the neighbor vertices in the adjacent
     // sweep line, check for validity
     const double distAdjacency = 2.0;
+    const auto& vertexList = res_.graphStructure.vertex;
+    std::vector<Coordinate> v1;
+    std::vector<Coordinate> v2;
     for (size_t m0 = startIdCur; m0 < endIdCur; ++m0) {
-        auto v1 = res_.graphStructure.vertex[m0];
+        vertexList.decode(m0, v1);
         for (size_t m1 = startIdExist; m1 < endIdExist; ++m1) {
-            auto v2 = res_.graphStructure.vertex[m1];
-
             // Locate the neighbor vertices in the adjacent
             // sweep line, check for validity
-            if (std::fabs(v1[1] - v2[1]) >
+            if (std::fabs(v1[1] - vertexList.getCoordinate(m1, 1)) >
                 distAdjacency *
                     std::fabs(param_.boundaryLimits[3] -
                               param_.boundaryLimits[2]) /
@@ -183,6 +216,7 @@ void hrm::planners::HRM2D::connectExistSlice(const Index sliceId) {
                 continue;
             }
 
+            vertexList.decode(m1, v2);
             if (isSameSliceTransitionFree(v1, v2)) {
                 // Add new connections
                 res_.graphStructure.edge.push_back(std::make_pair(m0, m1));
@@ -214,37 +248,38 @@ void hrm::planners::HRM2D::bridgeSlice() {
 
 bool hrm::planners::HRM2D::isSameSliceTransitionFree(
     const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
-    // Intersection between line segment and polygons
-    struct intersect {
-        intersect(std::vector<Coordinate> v1, std::vector<Coordinate> v2)
-            : v1_(std::move(v1)), v2_(std::move(v2)) {}
+    res_.operationCount.numTransitionCheck++;
+    return isSameSliceSegmentFree(v1, v2);
+}
 
-        bool operator()(const BoundaryPoints& obstacle) {
-            return isIntersectSegPolygon2D(std::make_pair(v1_, v2_), obstacle);
+bool hrm::planners::HRM2D::isSameSliceSegmentFree(
+    const std::vector<Coordinate>& v1,
+    const std::vector<Coordinate>& v2) const {
+    // Intersection between line segment and polygons, rejected by bounding
+    // boxes first
+    const auto seg = std::make_pair(v1, v2);
+    for (size_t i = 0; i < sliceBound_.obstacle.size(); ++i) {
+        if (isIntersectSegBox2D(seg, sliceBoundBox_.at(i)) &&
+            isIntersectSegPolygon2D(seg, sliceBound_.obstacle.at(i))) {
+            return false;
         }
+    }
 
-        std::vector<Coordinate> v1_;
-        std::vector<Coordinate> v2_;
-    };
-
-    return !std::any_of(sliceBound_.obstacle.cbegin(),
-                        sliceBound_.obstacle.cend(), intersect(v1, v2));
+    return true;
 }
 
 // Connect vertices among different slices
 bool hrm::planners::HRM2D::isMultiSliceTransitionFree(
     const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
-    const double dt = 1.0 / (static_cast<double>(param_.numPoint) - 1);
-    for (size_t i = 0; i < param_.numPoint; ++i) {
-        // Interpolate robot motion linearly from v1 to v2
-        std::vector<Coordinate> vStep;
-        for (size_t j = 0; j < v1.size(); ++j) {
-            vStep.push_back((1.0 - static_cast<double>(i) * dt) * v1[j] +
-                            static_cast<double>(i) * dt * v2[j]);
-        }
+    res_.operationCount.numTransitionCheck++;
+
+    // Interpolate robot motion linearly from v1 to v2
+    interpolateRn(toConfiguration<3>(v1), toConfiguration<3>(v2),
+                  param_.numPoint - 1, vInterp_);
 
+    for (const auto& vStep : vInterp_) {
         // Transform the robot
-        setTransform(vStep);
+        setTransformSE2(vStep);
 
         // For base, check whether the TFE is in free space of bridge
         // C-slice
@@ -281,24 +316,49 @@ bool hrm::planners::HRM2D::isPtInCFree(const Index bdIdx,
     return true;
 }
 
+bool hrm::planners::HRM2D::setPathSlice(const std::vector<Coordinate>& v) {
+    // C-slices are not stored in streaming mode
+    for (size_t i = 0; i < sliceBoundAll_.size() && i < headings_.size();
+         ++i) {
+        if (std::fabs(std::remainder(v[2] - headings_.at(i), 2.0 * PI)) <
+            EPSILON) {
+            sliceBound_ = sliceBoundAll_.at(i);
+            sliceBoundBox_.clear();
+            for (const auto& obstacle : sliceBound_.obstacle) {
+                sliceBoundBox_.push_back(getBoundingBox2D(obstacle));
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void hrm::planners::HRM2D::setPathBridgeSlice(
+    const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
+    computeTFE(v1[2], v2[2], tfe_);
+    bridgeSlice();
+}
+
 std::vector<hrm::planners::Vertex>
 hrm::planners::HRM2D::getNearestNeighborsOnGraph(
     const std::vector<Coordinate>& vertex, const Index k, const double radius) {
     // Find the closest roadmap vertex
     double minEuclideanDist = INFINITY;
     double minAngleDist = INFINITY;
-    double minAngle = res_.graphStructure.vertex[0][2];
+    double minAngle = res_.graphStructure.vertex.getCoordinate(0, 2);
     double angleDist = 0.0;
     double euclideanDist = 0.0;
     std::vector<Vertex> idx;
 
     // Find the closest C-slice
     minAngleDist = std::fabs(vertex[2] - minAngle);
-    for (auto vtx : res_.graphStructure.vertex) {
-        angleDist = std::fabs(vertex[2] - vtx[2]);
+    for (size_t i = 0; i < res_.graphStructure.vertex.size(); ++i) {
+        const double angle = res_.graphStructure.vertex.getCoordinate(i, 2);
+        angleDist = std::fabs(vertex[2] - angle);
         if (angleDist < minAngleDist) {
             minAngleDist = angleDist;
-            minAngle = vtx[2];
+            minAngle = angle;
         }
     }
 
@@ -320,18 +380,24 @@ hrm::planners::HRM2D::getNearestNeighborsOnGraph(
         Vertex idxSlice = 0;
         minEuclideanDist =
             vectorEuclidean(vertex, res_.graphStructure.vertex[0]);
+        std::vector<Coordinate> vtx;
         for (size_t i = 0; i < res_.graphStructure.vertex.size(); ++i) {
-            euclideanDist =
-                vectorEuclidean(vertex, res_.graphStructure.vertex[i]);
-            if ((euclideanDist < minEuclideanDist) &&
-                std::fabs(res_.graphStructure.vertex[i][2] - angCur) <
-                    EPSILON) {
+            // Vertices are decoded only at the C-slice
+            if (std::fabs(res_.graphStructure.vertex.getCoordinate(i, 2) -
+                          angCur) >= EPSILON) {
+                continue;
+            }
+
+            res_.graphStructure.vertex.decode(i, vtx);
+            euclideanDist = vectorEuclidean(vertex, vtx);
+            if (euclideanDist < minEuclideanDist) {
                 minEuclideanDist = euclideanDist;
                 idxSlice = i;
             }
         }
 
-        if (std::abs(vertex[1] - res_.graphStructure.vertex[idxSlice][1]) <
+        if (std::abs(vertex[1] -
+                     res_.graphStructure.vertex.getCoordinate(idxSlice, 1)) <
             radius * (param_.boundaryLimits[1] - param_.boundaryLimits[0]) /
                 static_cast<double>(param_.numLineY)) {
             idx.push_back(idxSlice);
@@ -342,6 +408,10 @@ hrm::planners::HRM2D::getNearestNeighborsOnGraph(
 }
 
 void hrm::planners::HRM2D::setTransform(const std::vector<Coordinate>& v) {
+    setTransformSE2(toConfiguration<3>(v));
+}
+
+void hrm::planners::HRM2D::setTransformSE2(const ConfigurationSE2& v) {
     SE2Transform g;
     g.topLeftCorner(2, 2) = Eigen::Rotation2Dd(v[2]).toRotationMatrix();
     g.topRightCorner(2, 1) = Point2D(v[0], v[1]);
@@ -355,8 +425,9 @@ void hrm::planners::HRM2D::computeTFE(const double thetaA, const double thetaB,
 
     // Compute a tightly-fitted ellipse that bounds rotational motions from
     // thetaA to thetaB
-    tfe.push_back(getTFE2D(robot_.getBase().getSemiAxis(), thetaA, thetaB,
-                           param_.numPoint, robot_.getBase().getNum()));
+    tfe.push_back(tfeCache_.getTFE2D(robot_.getBase().getSemiAxis(), thetaA,
+                                     thetaB, param_.numPoint,
+                                     robot_.getBase().getNum()));
 
     for (size_t i = 0; i < robot_.getNumLinks(); ++i) {
         Eigen::Rotation2Dd rotLink(
@@ -366,7 +437,7 @@ void hrm::planners::HRM2D::computeTFE(const double thetaA, const double thetaB,
         Eigen::Rotation2Dd rotB(Eigen::Rotation2Dd(thetaB).toRotationMatrix() *
                                 rotLink);
 
-        tfe.push_back(getTFE2D(
+        tfe.push_back(tfeCache_.getTFE2D(
             robot_.getLinks().at(i).getSemiAxis(), rotA.angle(), rotB.angle(),
             uint(param_.numPoint), robot_.getLinks().at(i).getNum()));
     }
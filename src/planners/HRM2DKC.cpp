@@ -33,6 +33,7 @@ void hrm::planners::HRM2DKC::connectMultiSlice() {
     std::vector<Coordinate> v2;
     std::vector<Coordinate> midVtx;
 
+    const auto startTime = Clock::now();
     for (size_t i = 0; i < param_.numSlice; ++i) {
         // Find vertex only in adjecent slices
         n11 = vertexIdx_.at(i).slice;
@@ -46,15 +47,17 @@ void hrm::planners::HRM2DKC::connectMultiSlice() {
 
         // Nearest vertex btw slices
         for (size_t m = start; m < n11; ++m) {
-            v1 = res_.graphStructure.vertex[m];
+            res_.graphStructure.vertex.decode(m, v1);
 
             for (size_t m2 = n12; m2 < n2; ++m2) {
-                v2 = res_.graphStructure.vertex[m2];
+                res_.graphStructure.vertex.decode(m2, v2);
 
                 // Judge connectivity using Kinematics of Containment
+                res_.operationCount.numTransitionCheck++;
                 midVtx = addMiddleVertex(v1, v2);
                 if (!midVtx.empty()) {
-                    res_.graphStructure.vertex.push_back(midVtx);
+                    res_.operationCount.numBridgeVertex++;
+                    res_.graphStructure.vertex.pushException(midVtx);
 
                     res_.graphStructure.edge.push_back(std::make_pair(m, n));
                     res_.graphStructure.weight.push_back(
@@ -70,6 +73,8 @@ void hrm::planners::HRM2DKC::connectMultiSlice() {
         }
         start = n11;
     }
+    res_.planningTime.phaseTime.connectMultiSliceTime +=
+        Durationd(Clock::now() - startTime).count();
 }
 
 std::vector<hrm::Coordinate> hrm::planners::HRM2DKC::addMiddleVertex(
@@ -2,10 +2,13 @@
 
 #include "hrm/planners/HRM3D.h"
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <numeric>
 #include <random>
+#include <thread>
 
 hrm::planners::HRM3D::HRM3D(const MultiBodyTree3D& robot,
                             const std::vector<SuperQuadrics>& arena,
@@ -30,27 +33,41 @@ void hrm::planners::HRM3D::constructOneSlice(const Index sliceIdx) {
         setTransform(v_.at(sliceIdx));
     }
 
-    // Add new C-slice
-    if (!isRefine_) {
+    // Add new C-slice, or regenerate the released one in streaming mode
+    if (!isRefine_ || param_.isStreamingSlice) {
         // Generate Minkowski operation boundaries
+        auto start = Clock::now();
         freeSpacePtr_->computeCSpaceBoundary();
         sliceBound_ = freeSpacePtr_->getCSpaceBoundary();
-        sliceBoundAll_.push_back(sliceBound_);
+        res_.planningTime.phaseTime.minkSumTime +=
+            Durationd(Clock::now() - start).count();
 
         // Generate mesh for the boundaries
+        start = Clock::now();
         freeSpacePtr_->computeCSpaceBoundaryMesh(sliceBound_);
         sliceBoundMesh_ = freeSpacePtr_->getCSpaceBoundaryMesh();
-        sliceBoundMeshAll_.push_back(sliceBoundMesh_);
+        res_.planningTime.phaseTime.meshTime +=
+            Durationd(Clock::now() - start).count();
+
+        // Only the current C-slice is kept in streaming mode
+        if (!param_.isStreamingSlice) {
+            sliceBoundAll_.push_back(sliceBound_);
+            sliceBoundMeshAll_.push_back(sliceBoundMesh_);
+        }
     } else {
         sliceBound_ = sliceBoundAll_.at(sliceIdx);
         sliceBoundMesh_ = sliceBoundMeshAll_.at(sliceIdx);
+        freeSpacePtr_->setCSpaceBoundaryMesh(sliceBoundMesh_);
     }
 
     // Sweep-line process to generate collision free line segments
     sweepLineProcess();
 
     // Connect vertices within one C-slice
+    const auto start = Clock::now();
     connectOneSlice3D(freeSegOneSlice_);
+    res_.planningTime.phaseTime.connectOneSliceTime +=
+        Durationd(Clock::now() - start).count();
 }
 
 /** \brief Sample from SO(3). If the orientation exists, no addition and record
@@ -62,9 +79,10 @@ void hrm::planners::HRM3D::sampleOrientations() {
 
 void hrm::planners::HRM3D::sweepLineProcess() {
     // x- and y-coordinates of sweep lines
+    const Index numLineX = param_.numLineX;
     std::vector<Coordinate> ty(param_.numLineY);
     const double dx = (param_.boundaryLimits[1] - param_.boundaryLimits[0]) /
-                      static_cast<double>(param_.numLineX - 1);
+                      static_cast<double>(numLineX - 1);
     const double dy = (param_.boundaryLimits[3] - param_.boundaryLimits[2]) /
                       static_cast<double>(param_.numLineY - 1);
 
@@ -72,21 +90,87 @@ void hrm::planners::HRM3D::sweepLineProcess() {
         ty[i] = param_.boundaryLimits[2] + static_cast<double>(i) * dy;
     }
 
-    // Find intersections along each sweep line
-    freeSegOneSlice_.tx.clear();
-    freeSegOneSlice_.freeSegmentYZ.clear();
-    for (size_t i = 0; i < param_.numLineX; ++i) {
-        // x-coordinates of sweep lines
-        freeSegOneSlice_.tx.push_back(param_.boundaryLimits[0] +
-                                      static_cast<double>(i) * dx);
-
-        std::vector<std::vector<Coordinate>> tLine{freeSegOneSlice_.tx, ty};
-        freeSpacePtr_->computeIntersectionInterval(tLine);
-
-        // Store freeSeg info
-        freeSpacePtr_->computeFreeSegment(ty);
-        freeSegOneSlice_.freeSegmentYZ.push_back(
-            freeSpacePtr_->getFreeSegment());
+    freeSegOneSlice_.tx.resize(numLineX);
+    for (size_t i = 0; i < numLineX; ++i) {
+        freeSegOneSlice_.tx[i] =
+            param_.boundaryLimits[0] + static_cast<double>(i) * dx;
+    }
+    freeSegOneSlice_.freeSegmentYZ.assign(numLineX, FreeSegment2D());
+
+    // Planes of sweep lines are split into blocks. Each worker starts from a
+    // contiguous range of blocks and steals blocks from the ranges of others
+    // once its own range is exhausted
+    const Index numThread =
+        std::max(Index(1), std::min(param_.numThread, numLineX));
+    const Index blockSize = std::max(Index(1), numLineX / (8 * numThread));
+    const Index numBlock = (numLineX + blockSize - 1) / blockSize;
+
+    std::vector<std::atomic<Index>> nextBlock(numThread);
+    std::vector<Index> endBlock(numThread);
+    for (size_t id = 0; id < numThread; ++id) {
+        nextBlock.at(id) = id * numBlock / numThread;
+        endBlock.at(id) = (id + 1) * numBlock / numThread;
+    }
+
+    // Intersections and free segments are computed in the workspace of each
+    // worker, the free space computator is only read
+    std::vector<SweepLineWorkspace> workspace(numThread);
+    std::vector<double> rayCastTime(numThread, 0.0);
+    std::vector<double> freeSegmentTime(numThread, 0.0);
+    auto worker = [&](const Index id) {
+        freeSpacePtr_->initWorkspace(workspace.at(id), ty.size());
+
+        for (size_t k = 0; k < numThread; ++k) {
+            const Index owner = (id + k) % numThread;
+            for (Index block = nextBlock.at(owner)++;
+                 block < endBlock.at(owner); block = nextBlock.at(owner)++) {
+                const Index end = std::min(numLineX, (block + 1) * blockSize);
+                for (Index i = block * blockSize; i < end; ++i) {
+                    auto start = Clock::now();
+                    freeSpacePtr_->computeIntersectionInterval(
+                        freeSegOneSlice_.tx[i], ty, workspace.at(id));
+                    rayCastTime.at(id) +=
+                        Durationd(Clock::now() - start).count();
+
+                    start = Clock::now();
+                    freeSpacePtr_->computeFreeSegment(
+                        ty, workspace.at(id).intersect,
+                        freeSegOneSlice_.freeSegmentYZ[i]);
+                    freeSegmentTime.at(id) +=
+                        Durationd(Clock::now() - start).count();
+                }
+            }
+        }
+    };
+
+    const auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (size_t id = 1; id < numThread; ++id) {
+        workers.emplace_back(worker, id);
+    }
+    worker(0);
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    // Wall-clock time of the phases, shared in proportion to the time spent
+    // by workers
+    const double wallTime = Durationd(Clock::now() - start).count();
+    const double sumRayCastTime =
+        std::accumulate(rayCastTime.begin(), rayCastTime.end(), 0.0);
+    const double sumFreeSegmentTime =
+        std::accumulate(freeSegmentTime.begin(), freeSegmentTime.end(), 0.0);
+    if (sumRayCastTime + sumFreeSegmentTime > 0.0) {
+        res_.planningTime.phaseTime.rayCastTime +=
+            wallTime * sumRayCastTime / (sumRayCastTime + sumFreeSegmentTime);
+        res_.planningTime.phaseTime.freeSegmentTime +=
+            wallTime * sumFreeSegmentTime /
+            (sumRayCastTime + sumFreeSegmentTime);
+    }
+
+    for (const auto& ws : workspace) {
+        res_.operationCount.numRayCast += ws.numRayCast;
+        res_.operationCount.numTriangleTest += ws.numTriangleTest;
     }
 }
 
@@ -128,6 +212,8 @@ void hrm::planners::HRM3D::connectOneSlice3D(const FreeSegment3D& freeSeg) {
     }
     numVertex_.slice = res_.graphStructure.vertex.size();
 
+    std::vector<Coordinate> v1;
+    std::vector<Coordinate> v2;
     for (size_t i = 0; i < freeSeg.tx.size() - 1; ++i) {
         for (size_t j = 0; j < freeSeg.freeSegmentYZ.at(i).ty.size(); ++j) {
             n1 = numVertex_.line[i][j];
@@ -136,16 +222,15 @@ void hrm::planners::HRM3D::connectOneSlice3D(const FreeSegment3D& freeSeg) {
             // Connect vertex btw adjacent planes, only connect with same ty
             for (size_t k1 = 0; k1 < freeSeg.freeSegmentYZ.at(i).xM[j].size();
                  ++k1) {
+                res_.graphStructure.vertex.decode(n1 + k1, v1);
                 for (size_t k2 = 0;
                      k2 < freeSeg.freeSegmentYZ.at(i + 1).xM[j].size(); ++k2) {
-                    if (isSameSliceTransitionFree(
-                            res_.graphStructure.vertex[n1 + k1],
-                            res_.graphStructure.vertex[n2 + k2])) {
+                    res_.graphStructure.vertex.decode(n2 + k2, v2);
+                    if (isSameSliceTransitionFree(v1, v2)) {
                         res_.graphStructure.edge.push_back(
                             std::make_pair(n1 + k1, n2 + k2));
-                        res_.graphStructure.weight.push_back(vectorEuclidean(
-                            res_.graphStructure.vertex[n1 + k1],
-                            res_.graphStructure.vertex[n2 + k2]));
+                        res_.graphStructure.weight.push_back(
+                            vectorEuclidean(v1, v2));
                     } else {
                         bridgeVertex(n1 + k1, n2 + k2);
                     }
@@ -161,14 +246,23 @@ void hrm::planners::HRM3D::connectMultiSlice() {
     }
 
     for (size_t i = 0; i < vertexIdx_.size(); ++i) {
-        // Find the nearest C-slices
+        // Find the nearest C-slices among the preceding ones, from the
+        // neighbor table if possible
         double minDist = INFINITY;
         int minIdx = 0;
-        for (size_t j = 0; j != i && j < param_.numSlice; ++j) {
-            double dist = q_.at(i).angularDistance(q_.at(j));
-            if (dist < minDist) {
-                minDist = dist;
-                minIdx = static_cast<int>(j);
+        const auto neighbor =
+            std::find_if(sliceNeighbor_.at(i).cbegin(),
+                         sliceNeighbor_.at(i).cend(),
+                         [i](const Index j) { return j < i; });
+        if (neighbor != sliceNeighbor_.at(i).cend()) {
+            minIdx = static_cast<int>(*neighbor);
+        } else {
+            for (size_t j = 0; j != i && j < param_.numSlice; ++j) {
+                double dist = q_.at(i).angularDistance(q_.at(j));
+                if (dist < minDist) {
+                    minDist = dist;
+                    minIdx = static_cast<int>(j);
+                }
             }
         }
 
@@ -182,22 +276,30 @@ void hrm::planners::HRM3D::connectMultiSlice() {
         Index n2 = vertexIdx_.at(minIdx).slice;
 
         // Construct the middle slice
+        auto startTime = Clock::now();
         computeTFE(q_.at(i), q_.at(minIdx), tfe_);
         bridgeSlice();
-
-        // Nearest vertex btw slices
+        res_.planningTime.phaseTime.bridgeSliceTime +=
+            Durationd(Clock::now() - startTime).count();
+
+        // Nearest vertex btw slices, only the vertices passing the adjacency
+        // test are decoded
+        startTime = Clock::now();
+        const auto& vertexList = res_.graphStructure.vertex;
+        std::vector<Coordinate> v1;
+        std::vector<Coordinate> v2;
         for (size_t m0 = start; m0 < n2; ++m0) {
-            auto v1 = res_.graphStructure.vertex.at(m0);
+            const Coordinate x1 = vertexList.getCoordinate(m0, 0);
+            const Coordinate y1 = vertexList.getCoordinate(m0, 1);
+            vertexList.decode(m0, v1);
             for (size_t m1 = n22; m1 < n_2; ++m1) {
-                auto v2 = res_.graphStructure.vertex[m1];
-
                 // Locate the nearest vertices
-                if (std::fabs(v1.at(0) - v2.at(0)) >
+                if (std::fabs(x1 - vertexList.getCoordinate(m1, 0)) >
                         2.0 *
                             (param_.boundaryLimits[1] -
                              param_.boundaryLimits[0]) /
                             static_cast<double>(param_.numLineX) ||
-                    std::fabs(v1.at(1) - v2.at(1)) >
+                    std::fabs(y1 - vertexList.getCoordinate(m1, 1)) >
                         2.0 *
                             (param_.boundaryLimits[3] -
                              param_.boundaryLimits[2]) /
@@ -207,6 +309,7 @@ void hrm::planners::HRM3D::connectMultiSlice() {
 
                 //                n_check++;
 
+                vertexList.decode(m1, v2);
                 if (isMultiSliceTransitionFree(v1, v2)) {
                     // Add new connections
                     res_.graphStructure.edge.push_back(std::make_pair(m0, m1));
@@ -220,6 +323,8 @@ void hrm::planners::HRM3D::connectMultiSlice() {
             }
         }
         start = n2;
+        res_.planningTime.phaseTime.connectMultiSliceTime +=
+            Durationd(Clock::now() - startTime).count();
     }
 }
 
@@ -235,12 +340,15 @@ void hrm::planners::HRM3D::connectExistSlice(const Index sliceId) {
 
     // Locate the neighbor vertices in the adjacent
     // sweep line, check for validity
+    const auto& vertexList = res_.graphStructure.vertex;
+    std::vector<Coordinate> v1;
+    std::vector<Coordinate> v2;
     for (size_t m0 = startIdCur; m0 < endIdCur; ++m0) {
-        auto v1 = res_.graphStructure.vertex[m0];
+        const Coordinate x1 = vertexList.getCoordinate(m0, 0);
+        const Coordinate y1 = vertexList.getCoordinate(m0, 1);
+        vertexList.decode(m0, v1);
         for (size_t m1 = startIdExist; m1 < endIdExist; ++m1) {
-            auto v2 = res_.graphStructure.vertex[m1];
-
-            if (std::fabs(v1.at(0) - v2.at(0)) >
+            if (std::fabs(x1 - vertexList.getCoordinate(m1, 0)) >
                 2.0 *
                     std::fabs(param_.boundaryLimits[1] -
                               param_.boundaryLimits[0]) /
@@ -248,7 +356,7 @@ void hrm::planners::HRM3D::connectExistSlice(const Index sliceId) {
                 continue;
             }
 
-            if (std::fabs(v1.at(1) - v2.at(1)) >
+            if (std::fabs(y1 - vertexList.getCoordinate(m1, 1)) >
                 2.0 *
                     std::fabs(param_.boundaryLimits[3] -
                               param_.boundaryLimits[2]) /
@@ -256,6 +364,7 @@ void hrm::planners::HRM3D::connectExistSlice(const Index sliceId) {
                 continue;
             }
 
+            vertexList.decode(m1, v2);
             if (isSameSliceTransitionFree(v1, v2)) {
                 // Add new connections
                 res_.graphStructure.edge.push_back(std::make_pair(m0, m1));
@@ -307,9 +416,9 @@ void hrm::planners::HRM3D::bridgeSlice() {
         // calculate Minkowski boundary points and meshes for obstacles
         std::vector<MeshMatrix> bdMesh;
         for (const auto& obstacle : obs_) {
-            auto bd = obstacle.getMinkSum3D(tfe_.at(i), +1);
             bdMesh.push_back(
-                getMeshFromParamSurface(bd, obstacle.getNumParam()));
+                getMeshFromParamSurface(obstacle.getMinkSum3D(tfe_.at(i), +1),
+                                        obstacle.getNumParam()));
         }
 
         bridgeSliceBound_.at(i) = bdMesh;
@@ -318,6 +427,13 @@ void hrm::planners::HRM3D::bridgeSlice() {
 
 bool hrm::planners::HRM3D::isSameSliceTransitionFree(
     const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
+    res_.operationCount.numTransitionCheck++;
+    return isSameSliceSegmentFree(v1, v2);
+}
+
+bool hrm::planners::HRM3D::isSameSliceSegmentFree(
+    const std::vector<Coordinate>& v1,
+    const std::vector<Coordinate>& v2) const {
     // Define the line connecting v1 and v2
     Point3D t1{v1[0], v1[1], v1[2]};
     Point3D t2{v2[0], v2[1], v2[2]};
@@ -366,14 +482,9 @@ bool hrm::planners::HRM3D::isSameSliceTransitionFree(
 
 bool hrm::planners::HRM3D::isMultiSliceTransitionFree(
     const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
-    // Interpolated robot motion from v1 to v2
-    const std::vector<std::vector<Coordinate>> vInterp =
-        interpolateCompoundSE3Rn(v1, v2, param_.numPoint);
-
-    for (const auto& vStep : vInterp) {
-        // Transform the robot
-        setTransform(vStep);
+    res_.operationCount.numTransitionCheck++;
 
+    auto isRobotInCFree = [this]() {
         // Base: determine whether each step is within CF-Line of bridgeSlice
         if (!isPtInCFree(0, robot_.getBase().getPosition())) {
             return false;
@@ -386,6 +497,35 @@ bool hrm::planners::HRM3D::isMultiSliceTransitionFree(
                 return false;
             }
         }
+
+        return true;
+    };
+
+    // Rigid body: fixed-size SE(3) interpolation
+    if (isRobotRigid_) {
+        interpolateCompoundSE3Rn(toConfiguration<7>(v1), toConfiguration<7>(v2),
+                                 param_.numPoint, vInterp_);
+
+        for (const auto& vStep : vInterp_) {
+            setTransformSE3(vStep);
+            if (!isRobotInCFree()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Interpolated robot motion from v1 to v2
+    const std::vector<std::vector<Coordinate>> vInterp =
+        interpolateCompoundSE3Rn(v1, v2, param_.numPoint);
+
+    for (const auto& vStep : vInterp) {
+        // Transform the robot
+        setTransform(vStep);
+        if (!isRobotInCFree()) {
+            return false;
+        }
     }
 
     return true;
@@ -406,7 +546,8 @@ bool hrm::planners::HRM3D::isPtInCFree(const Index bdIdx,
             const auto intersectObs =
                 intersectVerticalLineMesh3D(lineZ_, bound);
 
-            if (!intersectObs.empty()) {
+            // A ray grazing the mesh may hit only one face
+            if (intersectObs.size() > 1) {
                 isIntersect =
                     v_[2] > std::fmin(intersectObs[0][2], intersectObs[1][2]) &&
                     v_[2] < std::fmax(intersectObs[0][2], intersectObs[1][2]);
@@ -424,20 +565,50 @@ bool hrm::planners::HRM3D::isPtInCFree(const Index bdIdx,
                         intersect(lineZ, v));
 }
 
-void hrm::planners::HRM3D::sampleSO3() {
-    srand(unsigned(std::time(nullptr)));
+bool hrm::planners::HRM3D::setPathSlice(const std::vector<Coordinate>& v) {
+    auto isSameShape = [&v](const std::vector<Coordinate>& config) {
+        for (size_t i = 7; i < v.size(); ++i) {
+            if (std::fabs(v[i] - config.at(i)) > EPSILON) {
+                return false;
+            }
+        }
+        return true;
+    };
 
-    q_.resize(param_.numSlice);
-    if (robot_.getBase().getQuatSamples().empty()) {
-        // Uniform random samples for Quaternions
-        for (size_t i = 0; i < param_.numSlice; ++i) {
-            q_.at(i) = Eigen::Quaterniond::UnitRandom();
+    // C-slices are not stored in streaming mode. Articulated robots also
+    // match joint angles
+    const Eigen::Quaterniond q(v[3], v[4], v[5], v[6]);
+    for (size_t i = 0; i < sliceBoundMeshAll_.size() && i < q_.size(); ++i) {
+        if ((q_.at(i).coeffs() - q.coeffs()).cwiseAbs().maxCoeff() <
+                EPSILON &&
+            (isRobotRigid_ || isSameShape(v_.at(i)))) {
+            sliceBoundMesh_ = sliceBoundMeshAll_.at(i);
+            return true;
         }
+    }
+
+    return false;
+}
+
+void hrm::planners::HRM3D::setPathBridgeSlice(
+    const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
+    computeTFE(Eigen::Quaterniond(v1[3], v1[4], v1[5], v1[6]),
+               Eigen::Quaterniond(v2[3], v2[4], v2[5], v2[6]), tfe_);
+    bridgeSlice();
+}
+
+void hrm::planners::HRM3D::sampleSO3() {
+    if (robot_.getBase().getQuatSamples().empty()) {
+        // Deterministic uniform grid of Quaternions
+        q_ = generateSO3Grid(param_.numSlice);
     } else {
         // Pre-defined samples of Quaternions
         param_.numSlice = robot_.getBase().getQuatSamples().size();
         q_ = robot_.getBase().getQuatSamples();
     }
+
+    // Adjacency of C-slices
+    sliceNeighbor_ = getSO3NearestNeighbors(q_, NUM_SLICE_NEIGHBOR);
 }
 
 std::vector<hrm::planners::Vertex>
@@ -479,25 +650,31 @@ hrm::planners::HRM3D::getNearestNeighborsOnGraph(
     for (const auto& quatCur : quatList) {
         Vertex idxSlice = 0;
         minEuclideanDist = INFINITY;
-        for (size_t i = 0; i < res_.graphStructure.vertex.size(); ++i) {
-            euclideanDist =
-                vectorEuclidean(vertex, res_.graphStructure.vertex[i]);
-
-            if (euclideanDist < minEuclideanDist &&
-                quatCur.angularDistance(Eigen::Quaterniond(
-                    res_.graphStructure.vertex[i][3],
-                    res_.graphStructure.vertex[i][4],
-                    res_.graphStructure.vertex[i][5],
-                    res_.graphStructure.vertex[i][6])) < 1e-6) {
+        const auto& vertexList = res_.graphStructure.vertex;
+        std::vector<Coordinate> vtx;
+        for (size_t i = 0; i < vertexList.size(); ++i) {
+            // Vertices are decoded only at the C-slice
+            if (quatCur.angularDistance(Eigen::Quaterniond(
+                    vertexList.getCoordinate(i, 3),
+                    vertexList.getCoordinate(i, 4),
+                    vertexList.getCoordinate(i, 5),
+                    vertexList.getCoordinate(i, 6))) >= 1e-6) {
+                continue;
+            }
+
+            vertexList.decode(i, vtx);
+            euclideanDist = vectorEuclidean(vertex, vtx);
+            if (euclideanDist < minEuclideanDist) {
                 minEuclideanDist = euclideanDist;
                 idxSlice = i;
             }
         }
 
-        if (std::abs(vertex[0] - res_.graphStructure.vertex[idxSlice][0]) <
+        const auto vtxSlice = res_.graphStructure.vertex[idxSlice];
+        if (std::abs(vertex[0] - vtxSlice[0]) <
                 radius * (param_.boundaryLimits[1] - param_.boundaryLimits[0]) /
                     static_cast<double>(param_.numLineX) &&
-            std::abs(vertex[1] - res_.graphStructure.vertex[idxSlice][1]) <
+            std::abs(vertex[1] - vtxSlice[1]) <
                 radius * (param_.boundaryLimits[3] - param_.boundaryLimits[2]) /
                     static_cast<double>(param_.numLineY)) {
             idx.push_back(idxSlice);
@@ -508,6 +685,10 @@ hrm::planners::HRM3D::getNearestNeighborsOnGraph(
 }
 
 void hrm::planners::HRM3D::setTransform(const std::vector<Coordinate>& v) {
+    setTransformSE3(toConfiguration<7>(v));
+}
+
+void hrm::planners::HRM3D::setTransformSE3(const ConfigurationSE3& v) {
     SE3Transform g;
     g.topLeftCorner(3, 3) =
         Eigen::Quaterniond(v[3], v[4], v[5], v[6]).toRotationMatrix();
@@ -525,15 +706,16 @@ void hrm::planners::HRM3D::computeTFE(const Eigen::Quaterniond& q1,
 
     // Compute a tightly-fitted ellipsoid that bounds rotational motions
     // from q1 to q2
-    tfe.push_back(getTFE3D(robot_.getBase().getSemiAxis(), q1, q2,
-                           param_.numPoint, robot_.getBase().getNumParam()));
+    tfe.push_back(tfeCache_.getTFE3D(robot_.getBase().getSemiAxis(), q1, q2,
+                                     param_.numPoint,
+                                     robot_.getBase().getNumParam()));
 
     for (size_t i = 0; i < robot_.getNumLinks(); ++i) {
         Eigen::Matrix3d rotLink = robot_.getTF().at(i).topLeftCorner(3, 3);
-        tfe.push_back(
-            getTFE3D(robot_.getLinks().at(i).getSemiAxis(),
-                     Eigen::Quaterniond(q1.toRotationMatrix() * rotLink),
-                     Eigen::Quaterniond(q2.toRotationMatrix() * rotLink),
-                     param_.numPoint, robot_.getLinks().at(i).getNumParam()));
+        tfe.push_back(tfeCache_.getTFE3D(
+            robot_.getLinks().at(i).getSemiAxis(),
+            Eigen::Quaterniond(q1.toRotationMatrix() * rotLink),
+            Eigen::Quaterniond(q2.toRotationMatrix() * rotLink),
+            param_.numPoint, robot_.getLinks().at(i).getNumParam()));
     }
 }
@@ -2,7 +2,14 @@
 
 #include "hrm/planners/ProbHRM3D.h"
 
-#include "ompl/util/RandomNumbers.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
 
 hrm::planners::ProbHRM3D::ProbHRM3D(const MultiBodyTree3D& robot,
                                     std::string urdfFile,
@@ -16,9 +23,28 @@ hrm::planners::ProbHRM3D::ProbHRM3D(const MultiBodyTree3D& robot,
 hrm::planners::ProbHRM3D::~ProbHRM3D() = default;
 
 void hrm::planners::ProbHRM3D::plan(const double timeLim) {
-    auto start = Clock::now();
     param_.numSlice = 0;
 
+    if (param_.numThread > 1) {
+        planParallel(timeLim);
+    } else {
+        planSequential(timeLim);
+    }
+
+    // Retrieve coordinates of solved path
+    if (res_.solved) {
+        res_.solutionPath.solvedPath = getSolutionPath();
+        if (param_.isShortcutPath) {
+            shortcutPath();
+        }
+        res_.solutionPath.interpolatedPath =
+            getInterpolatedSolutionPath(param_.numPoint);
+    }
+}
+
+void hrm::planners::ProbHRM3D::planSequential(const double timeLim) {
+    auto start = Clock::now();
+
     do {
         // Randomly generate rotations and joint angles
         sampleOrientations();
@@ -54,51 +80,300 @@ void hrm::planners::ProbHRM3D::plan(const double timeLim) {
             vertexIdxAll_.size() < param_.numPoint) {
             refineExistRoadmap(timeLim);
         }
+
+        start = Clock::now();
     } while (!res_.solved && res_.planningTime.totalTime < timeLim);
+}
 
-    // Retrieve coordinates of solved path
-    if (res_.solved) {
-        res_.solutionPath.solvedPath = getSolutionPath();
-        res_.solutionPath.interpolatedPath =
-            getInterpolatedSolutionPath(param_.numPoint);
+void hrm::planners::ProbHRM3D::planParallel(const double timeLim) {
+    // Each worker owns a planner instance, so that free space computator,
+    // robot model and URDF parser are not shared among threads. Sweep lines
+    // of each C-slice are processed sequentially by its worker
+    PlanningRequest req;
+    req.isRobotRigid = false;
+    req.parameters = param_;
+    req.parameters.numThread = 1;
+    req.start = start_;
+    req.goal = goal_;
+
+    std::vector<std::unique_ptr<ProbHRM3D>> builders;
+    for (size_t i = 0; i < param_.numThread; ++i) {
+        builders.push_back(std::make_unique<ProbHRM3D>(robot_, urdfFile_,
+                                                       arena_, obs_, req));
+    }
+
+    // Finished C-slices waiting to be connected to the roadmap, bounded by
+    // the number of workers
+    std::queue<SliceData> sliceQueue;
+    std::mutex queueMutex;
+    std::condition_variable sliceReady;
+    std::condition_variable slotFree;
+    std::atomic<bool> isStopped{false};
+    std::atomic<Index> sampleId{0};
+    const Index maxQueueSize = param_.numThread;
+
+    // Resolution of sweep lines for newly constructed C-slices, updated after
+    // refinement (guarded by queueMutex)
+    Index numLineX = param_.numLineX;
+    Index numLineY = param_.numLineY;
+
+    // First exception thrown by a worker, rethrown by the calling thread
+    // (guarded by queueMutex)
+    std::exception_ptr workerError;
+
+    auto worker = [&](ProbHRM3D* builder) {
+        ompl::RNG rng;
+
+        try {
+            while (!isStopped) {
+                const Index id = sampleId++;
+
+                {
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                    if (builder->param_.numLineY != numLineY) {
+                        builder->freeSpacePtr_->setup(
+                            numLineY, builder->param_.boundaryLimits[4],
+                            builder->param_.boundaryLimits[5]);
+                    }
+                    builder->param_.numLineX = numLineX;
+                    builder->param_.numLineY = numLineY;
+                }
+
+                // Sample and construct one C-slice
+                SliceData slice =
+                    builder->buildSlice(builder->sampleConfiguration(id, rng));
+
+                std::unique_lock<std::mutex> lock(queueMutex);
+                slotFree.wait(lock, [&] {
+                    return isStopped || sliceQueue.size() < maxQueueSize;
+                });
+                if (isStopped) {
+                    return;
+                }
+                sliceQueue.push(std::move(slice));
+                lock.unlock();
+                sliceReady.notify_one();
+            }
+        } catch (...) {
+            // Stop all the threads, the calling thread rethrows
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                if (!workerError) {
+                    workerError = std::current_exception();
+                }
+                isStopped = true;
+            }
+            sliceReady.notify_all();
+            slotFree.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (auto& builder : builders) {
+        workers.emplace_back(worker, builder.get());
+    }
+
+    // Exception from either the calling thread or workers, rethrown after
+    // all the workers are joined
+    std::exception_ptr error;
+    try {
+        auto start = Clock::now();
+        do {
+            // Wait for a C-slice no longer than the remaining planning time
+            const auto deadline =
+                start + std::chrono::duration_cast<Clock::duration>(Durationd(
+                            timeLim - res_.planningTime.totalTime));
+
+            SliceData slice;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                if (!sliceReady.wait_until(lock, deadline, [&] {
+                        return !sliceQueue.empty() || workerError;
+                    })) {
+                    res_.planningTime.buildTime +=
+                        Durationd(Clock::now() - start).count();
+                    res_.planningTime.totalTime =
+                        res_.planningTime.buildTime +
+                        res_.planningTime.searchTime;
+                    break;
+                }
+                if (workerError) {
+                    break;
+                }
+
+                slice = std::move(sliceQueue.front());
+                sliceQueue.pop();
+            }
+            slotFree.notify_one();
+
+            // Add the C-slice to roadmap and connect among adjacent C-slices
+            mergeSlice(slice);
+            if (param_.numSlice >= 2) {
+                connectMultiSlice();
+            }
+
+            res_.planningTime.buildTime +=
+                Durationd(Clock::now() - start).count();
+
+            // Graph search
+            start = Clock::now();
+            search();
+            res_.planningTime.searchTime +=
+                Durationd(Clock::now() - start).count();
+
+            res_.planningTime.totalTime =
+                res_.planningTime.buildTime + res_.planningTime.searchTime;
+
+            // Double the number of sweep lines for every 10 iterations,
+            // C-slices that are under construction keep the previous
+            // resolution
+            if (param_.numSlice % 60 == 0 &&
+                vertexIdxAll_.size() < param_.numPoint) {
+                refineExistRoadmap(timeLim);
+
+                std::lock_guard<std::mutex> lock(queueMutex);
+                numLineX = param_.numLineX;
+                numLineY = param_.numLineY;
+            }
+
+            start = Clock::now();
+        } while (!res_.solved && res_.planningTime.totalTime < timeLim);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    // Stop workers, unfinished C-slices are discarded
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        isStopped = true;
+    }
+    slotFree.notify_all();
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    if (!error) {
+        error = workerError;
+    }
+    if (error) {
+        std::rethrow_exception(error);
     }
 }
 
 void hrm::planners::ProbHRM3D::sampleOrientations() {
     // Iteratively add slices with random orientations
-    srand(unsigned(std::time(nullptr)));
     ompl::RNG rng;
+    const std::vector<Coordinate> config =
+        sampleConfiguration(param_.numSlice, rng);
 
-    // Randomly sample rotation of base
-    if (param_.numSlice == 0) {
-        q_.emplace_back(start_.at(3), start_.at(4), start_.at(5), start_.at(6));
-    } else if (param_.numSlice == 1) {
-        q_.emplace_back(goal_.at(3), goal_.at(4), goal_.at(5), goal_.at(6));
-    } else {
-        q_.emplace_back(Eigen::Quaterniond::UnitRandom());
+    q_.emplace_back(config.at(3), config.at(4), config.at(5), config.at(6));
+
+    // Store configuration for a robot shape
+    v_.push_back(config);
+}
+
+std::vector<hrm::Coordinate> hrm::planners::ProbHRM3D::sampleConfiguration(
+    const Index sampleId, ompl::RNG& rng) const {
+    const Index numJoint = kdl_->getKDLTree().getNrOfJoints();
+
+    // Start and goal configurations
+    if (sampleId == 0 || sampleId == 1) {
+        const std::vector<Coordinate>& endPoint =
+            sampleId == 0 ? start_ : goal_;
+        std::vector<Coordinate> config{0.0, 0.0, 0.0, endPoint.at(3),
+                                       endPoint.at(4), endPoint.at(5),
+                                       endPoint.at(6)};
+        for (size_t i = 0; i < numJoint; ++i) {
+            config.push_back(endPoint.at(7 + i));
+        }
+
+        return config;
     }
 
-    std::vector<double> config{0.0,           0.0,           0.0,
-                               q_.back().w(), q_.back().x(), q_.back().y(),
-                               q_.back().z()};
+    // Randomly sample rotation of base, in the order of (x, y, z, w)
+    double quat[4];
+    rng.quaternion(quat);
+    std::vector<Coordinate> config{0.0,     0.0,     0.0,    quat[3],
+                                   quat[0], quat[1], quat[2]};
 
     // Randomly sample joint angles
-    if (param_.numSlice == 0) {
-        for (size_t i = 0; i < kdl_->getKDLTree().getNrOfJoints(); ++i) {
-            config.push_back(start_.at(7 + i));
-        }
-    } else if (param_.numSlice == 1) {
-        for (size_t i = 0; i < kdl_->getKDLTree().getNrOfJoints(); ++i) {
-            config.push_back(goal_.at(7 + i));
-        }
-    } else {
-        for (size_t i = 0; i < kdl_->getKDLTree().getNrOfJoints(); ++i) {
-            config.push_back(rng.uniformReal(-maxJointAngle_, maxJointAngle_));
+    for (size_t i = 0; i < numJoint; ++i) {
+        config.push_back(rng.uniformReal(-maxJointAngle_, maxJointAngle_));
+    }
+
+    return config;
+}
+
+hrm::planners::ProbHRM3D::SliceData hrm::planners::ProbHRM3D::buildSlice(
+    const std::vector<Coordinate>& config) {
+    // Start from an empty roadmap holding only the current C-slice
+    res_.graphStructure = Graph();
+    res_.graphStructure.vertex.setLayout(3);
+    res_.planningTime.phaseTime = PhaseTime();
+    res_.operationCount = OperationCount();
+    v_ = {config};
+    sliceBoundAll_.clear();
+    sliceBoundMeshAll_.clear();
+    isRefine_ = false;
+
+    constructOneSlice(0);
+    numVertex_.slice = res_.graphStructure.vertex.size();
+
+    SliceData slice;
+    slice.config = config;
+    slice.bound = sliceBound_;
+    slice.boundMesh = sliceBoundMesh_;
+    slice.graph = std::move(res_.graphStructure);
+    slice.vertexIdx = numVertex_;
+    slice.phaseTime = res_.planningTime.phaseTime;
+    slice.operationCount = res_.operationCount;
+
+    return slice;
+}
+
+void hrm::planners::ProbHRM3D::mergeSlice(const SliceData& slice) {
+    const Index offset = res_.graphStructure.vertex.size();
+
+    // Append subgraph
+    res_.graphStructure.vertex.append(slice.graph.vertex);
+    for (const auto& edge : slice.graph.edge) {
+        res_.graphStructure.edge.emplace_back(edge.first + offset,
+                                              edge.second + offset);
+    }
+    res_.graphStructure.weight.insert(res_.graphStructure.weight.end(),
+                                      slice.graph.weight.begin(),
+                                      slice.graph.weight.end());
+
+    // Vertex index info in the roadmap
+    numVertex_ = slice.vertexIdx;
+    numVertex_.startId += offset;
+    numVertex_.slice += offset;
+    for (auto& id : numVertex_.plane) {
+        id += offset;
+    }
+    for (auto& plane : numVertex_.line) {
+        for (auto& id : plane) {
+            id += offset;
         }
     }
+    vertexIdx_.push_back(numVertex_);
+
+    // Statistics of constructing the C-slice in worker thread
+    res_.planningTime.phaseTime += slice.phaseTime;
+    res_.operationCount += slice.operationCount;
+
+    // C-slice info
+    v_.push_back(slice.config);
+    q_.emplace_back(slice.config.at(3), slice.config.at(4),
+                    slice.config.at(5), slice.config.at(6));
+    sliceBound_ = slice.bound;
+    sliceBoundMesh_ = slice.boundMesh;
+    if (!param_.isStreamingSlice) {
+        sliceBoundAll_.push_back(slice.bound);
+        sliceBoundMeshAll_.push_back(slice.boundMesh);
+    }
 
-    // Store configuration for a robot shape
-    v_.push_back(config);
+    param_.numSlice++;
 }
 
 // Connect adjacent C-slices
@@ -128,27 +403,36 @@ void hrm::planners::ProbHRM3D::connectMultiSlice() {
     const Index n1 = vertexIdx_.at(minIdx).slice;
 
     // Construct bridge C-slice
+    auto startTime = Clock::now();
     computeTFE(v_.back(), v_.at(minIdx), tfe_);
     bridgeSlice();
-
-    // Nearest vertex btw slices
+    res_.planningTime.phaseTime.bridgeSliceTime +=
+        Durationd(Clock::now() - startTime).count();
+
+    // Nearest vertex btw slices, only the vertices passing the adjacency test
+    // are decoded
+    startTime = Clock::now();
+    const auto& vertexList = res_.graphStructure.vertex;
+    std::vector<Coordinate> v1;
+    std::vector<Coordinate> v2;
     for (size_t m0 = start; m0 < n1; ++m0) {
-        auto v1 = res_.graphStructure.vertex.at(m0);
+        const Coordinate x1 = vertexList.getCoordinate(m0, 0);
+        const Coordinate y1 = vertexList.getCoordinate(m0, 1);
         for (size_t m1 = n12; m1 < n2; ++m1) {
-            auto v2 = res_.graphStructure.vertex.at(m1);
-
             // Locate the nearest vertices in the adjacent sweep lines
-            if (std::fabs(v1.at(0) - v2.at(0)) >
+            if (std::fabs(x1 - vertexList.getCoordinate(m1, 0)) >
                     2.0 *
                         (param_.boundaryLimits[1] - param_.boundaryLimits[0]) /
                         static_cast<double>(param_.numLineX) ||
-                std::fabs(v1.at(1) - v2.at(1)) >
+                std::fabs(y1 - vertexList.getCoordinate(m1, 1)) >
                     2.0 *
                         (param_.boundaryLimits[3] - param_.boundaryLimits[2]) /
                         static_cast<double>(param_.numLineY)) {
                 continue;
             }
 
+            vertexList.decode(m0, v1);
+            vertexList.decode(m1, v2);
             if (isMultiSliceTransitionFree(v1, v2)) {
                 // Add new connections
                 res_.graphStructure.edge.push_back(std::make_pair(m0, m1));
@@ -159,6 +443,8 @@ void hrm::planners::ProbHRM3D::connectMultiSlice() {
             }
         }
     }
+    res_.planningTime.phaseTime.connectMultiSliceTime +=
+        Durationd(Clock::now() - startTime).count();
 }
 
 // Generate collision-free vertices
@@ -212,6 +498,18 @@ void hrm::planners::ProbHRM3D::setTransform(const std::vector<Coordinate>& V) {
     robot_.robotTF(urdfFile_, g, jointConfig);
 }
 
+void hrm::planners::ProbHRM3D::setPathBridgeSlice(
+    const std::vector<Coordinate>& v1, const std::vector<Coordinate>& v2) {
+    // Robot shapes of C-slices are at the origin
+    std::vector<Coordinate> config1 = v1;
+    std::vector<Coordinate> config2 = v2;
+    std::fill(config1.begin(), config1.begin() + 3, 0.0);
+    std::fill(config2.begin(), config2.begin() + 3, 0.0);
+
+    computeTFE(config1, config2, tfe_);
+    bridgeSlice();
+}
+
 // Construct Tight-Fitted Ellipsoid (TFE) for articulated body
 void hrm::planners::ProbHRM3D::computeTFE(const std::vector<Coordinate>& v1,
                                           const std::vector<Coordinate>& v2,
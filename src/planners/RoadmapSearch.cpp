@@ -0,0 +1,344 @@
+/** \author Sipu Ruan */
+
+#include "hrm/planners/RoadmapSearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace {
+
+using QueueElement = std::pair<double, hrm::Index>;
+using MinQueue = std::priority_queue<QueueElement, std::vector<QueueElement>,
+                                     std::greater<QueueElement>>;
+
+const hrm::Index NO_VERTEX = std::numeric_limits<hrm::Index>::max();
+
+}  // namespace
+
+hrm::planners::RoadmapSearch::RoadmapSearch(const Graph& graph)
+    : RoadmapSearch(graph, ownLandmark_) {}
+
+hrm::planners::RoadmapSearch::RoadmapSearch(const Graph& graph,
+                                            LandmarkTable& landmark)
+    : graph_(graph), landmark_(landmark) {
+    // Adjacency lists in compressed sparse row format, each undirected edge
+    // is stored in both directions
+    const Index numVertex = graph_.vertex.size();
+    adjOffset_.assign(numVertex + 1, 0);
+    for (const auto& edge : graph_.edge) {
+        adjOffset_.at(edge.first + 1)++;
+        adjOffset_.at(edge.second + 1)++;
+    }
+    for (size_t i = 0; i < numVertex; ++i) {
+        adjOffset_[i + 1] += adjOffset_[i];
+    }
+
+    adjVertex_.resize(adjOffset_.back());
+    adjWeight_.resize(adjOffset_.back());
+    std::vector<Index> pos(adjOffset_.begin(), adjOffset_.end() - 1);
+    for (size_t i = 0; i < graph_.edge.size(); ++i) {
+        const Index u = graph_.edge[i].first;
+        const Index v = graph_.edge[i].second;
+
+        adjVertex_[pos[u]] = v;
+        adjWeight_[pos[u]++] = graph_.weight[i];
+        adjVertex_[pos[v]] = u;
+        adjWeight_[pos[v]++] = graph_.weight[i];
+    }
+}
+
+hrm::planners::RoadmapSearch::~RoadmapSearch() = default;
+
+void hrm::planners::RoadmapSearch::computeLandmarks(const Index numLandmark) {
+    landmark_.landmarks.clear();
+    landmark_.dist.clear();
+
+    const Index numVertex = graph_.vertex.size();
+    landmark_.numVertexSelected = numVertex;
+    landmark_.numEdge = graph_.edge.size();
+    if (numVertex == 0) {
+        return;
+    }
+
+    // Farthest-point selection: each new landmark is the reachable vertex
+    // farthest from all the selected ones
+    std::vector<double> minDist(numVertex,
+                                std::numeric_limits<double>::infinity());
+    Index next = 0;
+    for (size_t i = 0; i < numLandmark && i < numVertex; ++i) {
+        landmark_.landmarks.push_back(next);
+        landmark_.dist.emplace_back();
+        dijkstra(next, landmark_.dist.back());
+
+        double maxDist = 0.0;
+        for (size_t j = 0; j < numVertex; ++j) {
+            minDist[j] = std::fmin(minDist[j], landmark_.dist.back()[j]);
+            if (std::isfinite(minDist[j]) && minDist[j] > maxDist) {
+                maxDist = minDist[j];
+                next = j;
+            }
+        }
+
+        if (maxDist == 0.0) {
+            break;
+        }
+    }
+}
+
+void hrm::planners::RoadmapSearch::updateLandmarks(const Index numLandmark) {
+    const Index numVertex = graph_.vertex.size();
+    const Index numEdge = graph_.edge.size();
+    if (landmark_.landmarks.empty() || numEdge < landmark_.numEdge ||
+        numVertex < landmark_.numVertexSelected ||
+        double(numVertex) >=
+            LANDMARK_REFRESH_RATIO * double(landmark_.numVertexSelected)) {
+        computeLandmarks(numLandmark);
+        return;
+    }
+
+    // Appended edges only shorten the distances, which are propagated from
+    // the ends of the new edges
+    std::vector<Index> seeds;
+    for (auto& dist : landmark_.dist) {
+        dist.resize(numVertex, std::numeric_limits<double>::infinity());
+
+        seeds.clear();
+        for (size_t i = landmark_.numEdge; i < numEdge; ++i) {
+            const Index u = graph_.edge[i].first;
+            const Index v = graph_.edge[i].second;
+            if (dist[u] + graph_.weight[i] < dist[v]) {
+                dist[v] = dist[u] + graph_.weight[i];
+                seeds.push_back(v);
+            } else if (dist[v] + graph_.weight[i] < dist[u]) {
+                dist[u] = dist[v] + graph_.weight[i];
+                seeds.push_back(u);
+            }
+        }
+
+        propagateDistance(seeds, dist);
+    }
+
+    landmark_.numEdge = numEdge;
+}
+
+hrm::planners::RoadmapSearchResult hrm::planners::RoadmapSearch::search(
+    const Index source, const Index target, const Index strategy,
+    const double weight) const {
+    if (strategy == 1) {
+        return searchBidirectional(source, target);
+    } else if (strategy == 2) {
+        return searchAStar(source, target, 1.0, true);
+    } else if (strategy == 3) {
+        return searchAStar(source, target, std::fmax(weight, 1.0), false);
+    }
+
+    return searchAStar(source, target, 1.0, false);
+}
+
+hrm::planners::RoadmapSearchResult hrm::planners::RoadmapSearch::searchAStar(
+    const Index source, const Index target, const double weight,
+    const bool useLandmark) const {
+    RoadmapSearchResult res;
+
+    const Index numVertex = graph_.vertex.size();
+    std::vector<double> g(numVertex, std::numeric_limits<double>::infinity());
+    std::vector<Index> pred(numVertex, NO_VERTEX);
+    std::vector<bool> isClosed(numVertex, false);
+
+    MinQueue open;
+    g.at(source) = 0.0;
+    open.emplace(weight * heuristic(source, target, useLandmark), source);
+
+    while (!open.empty()) {
+        const Index u = open.top().second;
+        open.pop();
+        if (isClosed[u]) {
+            continue;
+        }
+
+        if (u == target) {
+            tracePath(source, target, target, pred, {}, res);
+            res.cost = g[target];
+            return res;
+        }
+
+        // Expand vertex, no re-opening of closed vertices
+        isClosed[u] = true;
+        res.numExpansion++;
+
+        for (Index k = adjOffset_[u]; k < adjOffset_[u + 1]; ++k) {
+            const Index v = adjVertex_[k];
+            const double gNew = g[u] + adjWeight_[k];
+            if (isClosed[v] || gNew >= g[v]) {
+                continue;
+            }
+
+            const double h = heuristic(v, target, useLandmark);
+            if (std::isinf(h)) {
+                continue;
+            }
+
+            g[v] = gNew;
+            pred[v] = u;
+            open.emplace(gNew + weight * h, v);
+        }
+    }
+
+    return res;
+}
+
+hrm::planners::RoadmapSearchResult
+hrm::planners::RoadmapSearch::searchBidirectional(const Index source,
+                                                  const Index target) const {
+    RoadmapSearchResult res;
+
+    const Index numVertex = graph_.vertex.size();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // Average potentials keep both directions consistent:
+    // pF(v) = (h(v, target) - h(v, source)) / 2, pB(v) = -pF(v)
+    auto potential = [this, source, target](const Index v) {
+        return 0.5 * (heuristic(v, target, false) -
+                      heuristic(v, source, false));
+    };
+
+    std::vector<double> g[2] = {std::vector<double>(numVertex, inf),
+                                std::vector<double>(numVertex, inf)};
+    std::vector<Index> pred[2] = {std::vector<Index>(numVertex, NO_VERTEX),
+                                  std::vector<Index>(numVertex, NO_VERTEX)};
+    std::vector<bool> isClosed[2] = {std::vector<bool>(numVertex, false),
+                                     std::vector<bool>(numVertex, false)};
+    MinQueue open[2];
+
+    g[0].at(source) = 0.0;
+    open[0].emplace(potential(source), source);
+    g[1].at(target) = 0.0;
+    open[1].emplace(-potential(target), target);
+
+    double bestCost = source == target ? 0.0 : inf;
+    Index meet = source == target ? source : NO_VERTEX;
+
+    while (!open[0].empty() && !open[1].empty()) {
+        // Terminate when no shorter path can be found by either direction
+        if (open[0].top().first + open[1].top().first >= bestCost) {
+            break;
+        }
+
+        // Expand the direction with smaller frontier
+        const int dir = open[0].size() <= open[1].size() ? 0 : 1;
+        const double sign = dir == 0 ? 1.0 : -1.0;
+
+        const Index u = open[dir].top().second;
+        open[dir].pop();
+        if (isClosed[dir][u]) {
+            continue;
+        }
+        isClosed[dir][u] = true;
+        res.numExpansion++;
+
+        for (Index k = adjOffset_[u]; k < adjOffset_[u + 1]; ++k) {
+            const Index v = adjVertex_[k];
+            const double gNew = g[dir][u] + adjWeight_[k];
+            if (gNew < g[dir][v]) {
+                g[dir][v] = gNew;
+                pred[dir][v] = u;
+                open[dir].emplace(gNew + sign * potential(v), v);
+            }
+
+            // Update the best connection between two search trees
+            if (g[dir][v] + g[1 - dir][v] < bestCost) {
+                bestCost = g[dir][v] + g[1 - dir][v];
+                meet = v;
+            }
+        }
+    }
+
+    if (meet != NO_VERTEX) {
+        tracePath(source, target, meet, pred[0], pred[1], res);
+        res.cost = bestCost;
+    }
+
+    return res;
+}
+
+double hrm::planners::RoadmapSearch::heuristic(const Index u, const Index v,
+                                               const bool useLandmark) const {
+    double h = graph_.vertex.getDistance(u, v);
+    if (!useLandmark) {
+        return h;
+    }
+
+    // Triangle inequality on landmark distances
+    for (const auto& dist : landmark_.dist) {
+        if (std::isinf(dist[u]) != std::isinf(dist[v])) {
+            // Two vertices are in disconnected components
+            return std::numeric_limits<double>::infinity();
+        } else if (std::isfinite(dist[u])) {
+            h = std::fmax(h, std::fabs(dist[u] - dist[v]));
+        }
+    }
+
+    return h;
+}
+
+void hrm::planners::RoadmapSearch::dijkstra(const Index source,
+                                            std::vector<double>& dist) const {
+    dist.assign(graph_.vertex.size(), std::numeric_limits<double>::infinity());
+    dist.at(source) = 0.0;
+
+    propagateDistance({source}, dist);
+}
+
+void hrm::planners::RoadmapSearch::propagateDistance(
+    const std::vector<Index>& seeds, std::vector<double>& dist) const {
+    MinQueue open;
+    for (const Index seed : seeds) {
+        open.emplace(dist[seed], seed);
+    }
+
+    while (!open.empty()) {
+        const double d = open.top().first;
+        const Index u = open.top().second;
+        open.pop();
+        if (d > dist[u]) {
+            continue;
+        }
+
+        for (Index k = adjOffset_[u]; k < adjOffset_[u + 1]; ++k) {
+            const Index v = adjVertex_[k];
+            if (d + adjWeight_[k] < dist[v]) {
+                dist[v] = d + adjWeight_[k];
+                open.emplace(dist[v], v);
+            }
+        }
+    }
+}
+
+void hrm::planners::RoadmapSearch::tracePath(
+    const Index source, const Index target, const Index meet,
+    const std::vector<Index>& predForward,
+    const std::vector<Index>& predBackward, RoadmapSearchResult& res) const {
+    res.path.clear();
+
+    // Source to meeting vertex
+    for (Index v = meet; v != NO_VERTEX; v = predForward[v]) {
+        res.path.push_back(v);
+        if (v == source) {
+            break;
+        }
+    }
+    std::reverse(res.path.begin(), res.path.end());
+
+    // Meeting vertex to target
+    if (!predBackward.empty()) {
+        for (Index v = meet; v != target;) {
+            v = predBackward[v];
+            res.path.push_back(v);
+        }
+    }
+
+    res.solved = true;
+}
@@ -0,0 +1,75 @@
+/** \author Sipu Ruan */
+
+#include "hrm/planners/ompl_interface/ClearanceMotionValidator.h"
+
+#include <cmath>
+#include <utility>
+
+hrm::planners::ompl_interface::ClearanceMotionValidator::
+    ClearanceMotionValidator(const ob::SpaceInformationPtr& si,
+                             ClearanceFn clearanceFn,
+                             const double displacementBound)
+    : ob::MotionValidator(si),
+      clearanceFn_(std::move(clearanceFn)),
+      displacementBound_(displacementBound) {}
+
+hrm::planners::ompl_interface::ClearanceMotionValidator::
+    ~ClearanceMotionValidator() = default;
+
+bool hrm::planners::ompl_interface::ClearanceMotionValidator::checkMotion(
+    const ob::State* s1, const ob::State* s2) const {
+    // Reject early by the end state, as the discrete motion validator
+    if (!si_->isValid(s2)) {
+        invalid_++;
+        return false;
+    }
+
+    std::pair<ob::State*, double> lastValid(nullptr, 0.0);
+    return checkMotion(s1, s2, lastValid);
+}
+
+bool hrm::planners::ompl_interface::ClearanceMotionValidator::checkMotion(
+    const ob::State* s1, const ob::State* s2,
+    std::pair<ob::State*, double>& lastValid) const {
+    const ob::StateSpacePtr& space = si_->getStateSpace();
+    const double dist = space->distance(s1, s2);
+    const double minStep = space->getLongestValidSegmentLength();
+
+    ob::State* state = si_->allocState();
+    si_->copyState(state, s1);
+
+    bool isValid = true;
+    double t = 0.0;
+    double tLastValid = 0.0;
+    while (true) {
+        // Positive clearance certifies the state, otherwise check exactly
+        const double clearance = clearanceFn_(state);
+        if (clearance <= 0.0 && !si_->isValid(state)) {
+            isValid = false;
+            break;
+        }
+
+        tLastValid = t;
+        if (t >= 1.0) {
+            break;
+        }
+
+        // Largest step within which the robot stays inside the clearance
+        const double step = std::fmax(clearance / displacementBound_, minStep);
+        t = dist > 0.0 ? std::fmin(t + step / dist, 1.0) : 1.0;
+        space->interpolate(s1, s2, t, state);
+    }
+
+    if (!isValid) {
+        if (lastValid.first != nullptr) {
+            space->interpolate(s1, s2, tLastValid, lastValid.first);
+        }
+        lastValid.second = tLastValid;
+        invalid_++;
+    } else {
+        valid_++;
+    }
+
+    si_->freeState(state);
+    return isValid;
+}
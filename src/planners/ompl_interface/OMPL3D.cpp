@@ -2,6 +2,8 @@
 
 #include "hrm/planners/ompl_interface/OMPL3D.h"
 
+#include <limits>
+
 using GeometryPtr = std::shared_ptr<fcl::CollisionGeometry<double>>;
 
 hrm::planners::ompl_interface::OMPL3D::OMPL3D(
@@ -95,26 +97,55 @@ void hrm::planners::ompl_interface::OMPL3D::setCollisionObject() {
                             robot_.getBase().getSemiAxis().at(1),
                             robot_.getBase().getSemiAxis().at(2)));
     objRobot_.emplace_back(fcl::CollisionObjectd(ellip));
+    semiAxisBody_.emplace_back(robot_.getBase().getSemiAxis().data());
     for (size_t i = 0; i < robot_.getNumLinks(); ++i) {
         GeometryPtr ellip(
             new fcl::Ellipsoidd(robot_.getLinks().at(i).getSemiAxis().at(0),
                                 robot_.getLinks().at(i).getSemiAxis().at(1),
                                 robot_.getLinks().at(i).getSemiAxis().at(2)));
         objRobot_.emplace_back(fcl::CollisionObjectd(ellip));
+        semiAxisBody_.emplace_back(
+            robot_.getLinks().at(i).getSemiAxis().data());
     }
 
     // Setup collision object for superquadric obstacles
+    std::vector<SuperQuadrics> obsEllipsoid;
+    std::vector<bool> isEllipsoid;
     for (const auto &obstacle : obstacle_) {
-        if (std::fabs(obstacle.getEpsilon().at(0) - 1.0) < 1e-6 &&
-            std::fabs(obstacle.getEpsilon().at(1) - 1.0) < 1e-6) {
+        isEllipsoid.push_back(
+            std::fabs(obstacle.getEpsilon().at(0) - 1.0) < 1e-6 &&
+            std::fabs(obstacle.getEpsilon().at(1) - 1.0) < 1e-6);
+
+        if (isEllipsoid.back()) {
             GeometryPtr ellip(new fcl::Ellipsoidd(
                 obstacle.getSemiAxis().at(0), obstacle.getSemiAxis().at(1),
                 obstacle.getSemiAxis().at(2)));
             objObs_.emplace_back(fcl::CollisionObjectd(ellip));
+            obsEllipsoid.push_back(obstacle);
         } else {
             objObs_.emplace_back(setCollisionObjectFromSQ(obstacle));
         }
+
+        // Obstacles are static, pose only once
+        objObs_.back().setTransform(
+            obstacle.getQuaternion().toRotationMatrix(),
+            fcl::Vector3d(obstacle.getPosition().at(0),
+                          obstacle.getPosition().at(1),
+                          obstacle.getPosition().at(2)));
+        objObs_.back().computeAABB();
+    }
+
+    // Ellipsoids are tested by the batched algebraic separation condition,
+    // others are registered for broad-phase collision checking
+    obsEllipsoid_ = getEllipsoidBatch(obsEllipsoid);
+
+    std::vector<fcl::CollisionObjectd *> objObsMesh;
+    for (size_t i = 0; i < objObs_.size(); ++i) {
+        if (!isEllipsoid.at(i)) {
+            objObsMesh.push_back(&objObs_.at(i));
+        }
     }
+    obsManager_.setObstacles(objObsMesh);
 }
 
 // Get pose info and transform the robot
@@ -157,6 +188,96 @@ bool hrm::planners::ompl_interface::OMPL3D::isSeparated(
     return true;
 }
 
+bool hrm::planners::ompl_interface::OMPL3D::computeBodyPoses(
+    const ob::State *state, BodyPoses &tfBody) const {
+    const auto *stateSE3 = state->as<ob::SE3StateSpace::StateType>();
+
+    fcl::Transform3d gBase = fcl::Transform3d::Identity();
+    gBase.linear() =
+        Eigen::Quaterniond(stateSE3->rotation().w, stateSE3->rotation().x,
+                           stateSE3->rotation().y, stateSE3->rotation().z)
+            .toRotationMatrix();
+    gBase.translation() << stateSE3->getX(), stateSE3->getY(),
+        stateSE3->getZ();
+
+    // Links are rigidly attached to the base
+    tfBody.resize(1 + robot_.getNumLinks());
+    tfBody[0] = gBase;
+    for (size_t i = 0; i < robot_.getNumLinks(); ++i) {
+        tfBody[i + 1].matrix() = gBase.matrix() * robot_.getTF()[i];
+    }
+
+    return true;
+}
+
+bool hrm::planners::ompl_interface::OMPL3D::isBodySeparated(
+    const BodyPoses &tfBody) const {
+    for (size_t j = 0; j < tfBody.size(); ++j) {
+        // Ellipsoidal obstacles
+        if (!isEllipsoidSeparated(semiAxisBody_[j], tfBody[j].matrix(),
+                                  obsEllipsoid_)) {
+            return false;
+        }
+
+        // Narrow phase only for obstacles overlapping with the bounding box
+        // of each body
+        if (obsManager_.isCollision(objRobot_[j].collisionGeometry(),
+                                    tfBody[j])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+double hrm::planners::ompl_interface::OMPL3D::computeClearance(
+    const ob::State *state) const {
+    thread_local BodyPoses tfBody;
+    computeBodyPoses(state, tfBody);
+
+    double clearance = std::numeric_limits<double>::infinity();
+    for (size_t j = 0; j < tfBody.size(); ++j) {
+        // Bounding spheres for ellipsoidal obstacles
+        const double radiusBody = semiAxisBody_[j].maxCoeff();
+        const Eigen::Vector3d &center = tfBody[j].translation();
+        for (size_t i = 0; i < obsEllipsoid_.size(); ++i) {
+            clearance = std::fmin(
+                clearance,
+                Eigen::Vector3d(obsEllipsoid_.centerX[i] - center.x(),
+                                obsEllipsoid_.centerY[i] - center.y(),
+                                obsEllipsoid_.centerZ[i] - center.z())
+                        .norm() -
+                    radiusBody - obsEllipsoid_.radiusOuter[i]);
+        }
+
+        // Distance to other obstacles from the broad-phase manager
+        clearance = std::fmin(
+            clearance,
+            obsManager_.getDistance(objRobot_[j].collisionGeometry(),
+                                    tfBody[j]));
+
+        if (clearance <= 0.0) {
+            return 0.0;
+        }
+    }
+
+    return clearance;
+}
+
+double hrm::planners::ompl_interface::OMPL3D::getDisplacementBound() const {
+    // The SE(3) distance in OMPL sums translation and half of rotation angle,
+    // a point at radius r moves at most max(1, 2r) per unit distance
+    double radius = robot_.getBase().getSemiAxis().at(0);
+    radius = std::fmax(radius, robot_.getBase().getSemiAxis().at(1));
+    radius = std::fmax(radius, robot_.getBase().getSemiAxis().at(2));
+    for (size_t i = 0; i < robot_.getNumLinks(); ++i) {
+        radius = std::fmax(radius, robot_.getTF()[i].block<3, 1>(0, 3).norm() +
+                                       semiAxisBody_.at(i + 1).maxCoeff());
+    }
+
+    return std::fmax(1.0, 2.0 * radius);
+}
+
 void hrm::planners::ompl_interface::OMPL3D::setStateFromVector(
     const std::vector<Coordinate> *stateVariables,
     ob::ScopedState<ob::CompoundStateSpace> *state) const {
@@ -12,6 +12,9 @@ hrm::planners::ompl_interface::OMPL3DArticulated::OMPL3DArticulated(
     // Parse URDF file and construct KDL tree
     kdl_ = new ParseURDF(urdfFile_);
     numJoint_ = kdl_->getKDLTree().getNrOfJoints();
+    for (size_t i = 0; i < robot_.getNumLinks(); ++i) {
+        bodyName_.push_back("body" + std::to_string(i + 1));
+    }
 
     setStateSpace(lowBound, highBound);
 }
@@ -79,6 +82,38 @@ hrm::planners::ompl_interface::OMPL3DArticulated::transformRobot(
     return robotAux;
 }
 
+bool hrm::planners::ompl_interface::OMPL3DArticulated::computeBodyPoses(
+    const ob::State* state, BodyPoses& tfBody) const {
+    const auto* stateBase =
+        state->as<ob::CompoundState>()->as<ob::SE3StateSpace::StateType>(0);
+    const auto* stateJoint =
+        state->as<ob::CompoundState>()->as<ob::RealVectorStateSpace::StateType>(
+            1);
+
+    SE3Transform gBase = SE3Transform::Identity();
+    gBase.topLeftCorner(3, 3) =
+        Eigen::Quaterniond(stateBase->rotation().w, stateBase->rotation().x,
+                           stateBase->rotation().y, stateBase->rotation().z)
+            .toRotationMatrix();
+    gBase.topRightCorner(3, 1) << stateBase->getX(), stateBase->getY(),
+        stateBase->getZ();
+
+    // Forward kinematics with the parsed KDL model, no re-parsing of URDF
+    thread_local KDL::JntArray jointArray;
+    jointArray.data =
+        Eigen::Map<const Eigen::VectorXd>(stateJoint->values, numJoint_);
+
+    tfBody.resize(1 + robot_.getNumLinks());
+    tfBody[0].matrix() = gBase;
+    for (size_t i = 0; i < robot_.getNumLinks(); ++i) {
+        tfBody[i + 1].matrix() = gBase *
+                                 kdl_->getTransform(jointArray, bodyName_[i]) *
+                                 robot_.getTF()[i];
+    }
+
+    return true;
+}
+
 void hrm::planners::ompl_interface::OMPL3DArticulated::setStateFromVector(
     const std::vector<Coordinate>* stateVariables,
     ob::ScopedState<ob::CompoundStateSpace>* state) const {
@@ -0,0 +1,319 @@
+/** \author Sipu Ruan */
+
+#include "hrm/test/util/BenchmarkRecorder.h"
+#include "hrm/GitRevision.h"
+#include "hrm/config.h"
+
+#include "ompl/util/RandomNumbers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+/** \brief Quoted and escaped JSON string */
+std::string toJsonString(const std::string& text) {
+    std::ostringstream out;
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (c == '\n') {
+            out << "\\n";
+        } else if (c == '\t') {
+            out << "\\t";
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << int(c) << std::dec;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+
+    return out.str();
+}
+
+/** \brief JSON number, null for NaN and infinity */
+std::string toJsonNumber(const double value) {
+    if (!std::isfinite(value)) {
+        return "null";
+    }
+
+    std::ostringstream out;
+    out << std::setprecision(std::numeric_limits<double>::max_digits10)
+        << value;
+    return out.str();
+}
+
+/** \brief Model name of the first CPU, empty if not available */
+std::string getCpuModel() {
+    std::ifstream cpuInfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuInfo, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            const auto pos = line.find(':');
+            if (pos != std::string::npos && pos + 2 <= line.size()) {
+                return line.substr(pos + 2);
+            }
+        }
+    }
+
+    return "";
+}
+
+/** \brief Current UTC time in ISO 8601 format */
+std::string getTimeStamp() {
+    const std::time_t now = std::time(nullptr);
+    std::tm utc{};
+    gmtime_r(&now, &utc);
+
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return buffer;
+}
+
+/** \brief Percentile of sorted values with linear interpolation
+ * \param sorted Sorted values, non-empty
+ * \param p Percentile in [0, 1] */
+double getPercentile(const std::vector<double>& sorted, const double p) {
+    const double pos = p * double(sorted.size() - 1);
+    const auto lower = size_t(std::floor(pos));
+    const auto upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted.at(lower) +
+           (pos - double(lower)) * (sorted.at(upper) - sorted.at(lower));
+}
+
+}  // namespace
+
+hrm::BenchmarkRecorder::BenchmarkRecorder(const std::string& name)
+    : name_(name) {
+    setMetadata("git_revision", HRM_GIT_REVISION);
+    setMetadata("compiler", HRM_CXX_COMPILER);
+    setMetadata("compiler_flags", HRM_CXX_FLAGS);
+    setMetadata("build_type", HRM_BUILD_TYPE);
+    setMetadata("cpu_model", getCpuModel());
+    setMetadata("hardware_threads",
+                double(std::thread::hardware_concurrency()));
+    setMetadata("time_stamp", getTimeStamp());
+    setMetadata("seed", double(ompl::RNG::getSeed()));
+}
+
+hrm::BenchmarkRecorder::~BenchmarkRecorder() = default;
+
+void hrm::BenchmarkRecorder::setMetadata(const std::string& key,
+                                         const std::string& value) {
+    setEntry(metadata_, key, toJsonString(value));
+}
+
+void hrm::BenchmarkRecorder::setMetadata(const std::string& key,
+                                         const double value) {
+    setEntry(metadata_, key, toJsonNumber(value));
+}
+
+void hrm::BenchmarkRecorder::setParameters(const PlannerParameter& param) {
+    std::string limits = "[";
+    for (size_t i = 0; i < param.boundaryLimits.size(); ++i) {
+        limits += (i > 0 ? ", " : "") + toJsonNumber(param.boundaryLimits[i]);
+    }
+    limits += "]";
+
+    setEntry(parameters_, "boundary_limits", limits);
+    setEntry(parameters_, "num_slice", toJsonNumber(double(param.numSlice)));
+    setEntry(parameters_, "num_line_x", toJsonNumber(double(param.numLineX)));
+    setEntry(parameters_, "num_line_y", toJsonNumber(double(param.numLineY)));
+    setEntry(parameters_, "num_point", toJsonNumber(double(param.numPoint)));
+    setEntry(parameters_, "num_search_neighbor",
+             toJsonNumber(double(param.numSearchNeighbor)));
+    setEntry(parameters_, "search_radius", toJsonNumber(param.searchRadius));
+    setEntry(parameters_, "search_strategy",
+             toJsonNumber(double(param.searchStrategy)));
+    setEntry(parameters_, "search_weight", toJsonNumber(param.searchWeight));
+    setEntry(parameters_, "num_landmark",
+             toJsonNumber(double(param.numLandmark)));
+    setEntry(parameters_, "num_thread", toJsonNumber(double(param.numThread)));
+    setEntry(parameters_, "is_streaming_slice",
+             param.isStreamingSlice ? "true" : "false");
+    setEntry(parameters_, "is_continuous_collision",
+             param.isContinuousCollision ? "true" : "false");
+    setEntry(parameters_, "is_shortcut_path",
+             param.isShortcutPath ? "true" : "false");
+}
+
+void hrm::BenchmarkRecorder::addTrial(const std::string& caseName,
+                                      const BenchmarkMetrics& metrics) {
+    auto benchCase = std::find_if(
+        cases_.begin(), cases_.end(),
+        [&caseName](const BenchmarkCase& c) { return c.name == caseName; });
+    if (benchCase == cases_.end()) {
+        cases_.push_back({caseName, {}, {}});
+        benchCase = cases_.end() - 1;
+        for (const auto& metric : metrics) {
+            benchCase->metricNames.push_back(metric.first);
+        }
+    }
+
+    // Values are aligned with the metric names of the first trial, missing
+    // ones are stored as NaN
+    std::vector<double> trial(benchCase->metricNames.size(),
+                              std::numeric_limits<double>::quiet_NaN());
+    for (const auto& metric : metrics) {
+        const auto it = std::find(benchCase->metricNames.begin(),
+                                  benchCase->metricNames.end(), metric.first);
+        if (it != benchCase->metricNames.end()) {
+            trial.at(it - benchCase->metricNames.begin()) = metric.second;
+        }
+    }
+    benchCase->trials.push_back(trial);
+}
+
+void hrm::BenchmarkRecorder::store(const std::string& filename) const {
+    auto writeObject =
+        [](std::ofstream& file,
+           const std::vector<std::pair<std::string, std::string>>& object,
+           const std::string& indent) {
+            file << '{';
+            for (size_t i = 0; i < object.size(); ++i) {
+                file << (i > 0 ? "," : "") << '\n'
+                     << indent << "  " << toJsonString(object[i].first)
+                     << ": " << object[i].second;
+            }
+            file << '\n' << indent << '}';
+        };
+
+    std::ofstream file(filename);
+    file << "{\n";
+    file << "  \"schema\": \"hrm_benchmark\",\n";
+    file << "  \"schema_version\": 1,\n";
+    file << "  \"benchmark\": " << toJsonString(name_) << ",\n";
+    file << "  \"metadata\": ";
+    writeObject(file, metadata_, "  ");
+    file << ",\n  \"parameters\": ";
+    writeObject(file, parameters_, "  ");
+    file << ",\n  \"cases\": [";
+
+    for (size_t i = 0; i < cases_.size(); ++i) {
+        const auto& benchCase = cases_[i];
+        file << (i > 0 ? "," : "") << "\n    {\n";
+        file << "      \"name\": " << toJsonString(benchCase.name) << ",\n";
+
+        file << "      \"metrics\": [";
+        for (size_t j = 0; j < benchCase.metricNames.size(); ++j) {
+            file << (j > 0 ? ", " : "")
+                 << toJsonString(benchCase.metricNames[j]);
+        }
+        file << "],\n";
+
+        file << "      \"trials\": [";
+        for (size_t k = 0; k < benchCase.trials.size(); ++k) {
+            file << (k > 0 ? "," : "") << "\n        [";
+            for (size_t j = 0; j < benchCase.trials[k].size(); ++j) {
+                file << (j > 0 ? ", " : "")
+                     << toJsonNumber(benchCase.trials[k][j]);
+            }
+            file << ']';
+        }
+        file << "\n      ],\n";
+
+        // Distribution statistics of each metric over the finite values
+        file << "      \"statistics\": {";
+        for (size_t j = 0; j < benchCase.metricNames.size(); ++j) {
+            std::vector<double> values;
+            for (const auto& trial : benchCase.trials) {
+                if (std::isfinite(trial[j])) {
+                    values.push_back(trial[j]);
+                }
+            }
+            std::sort(values.begin(), values.end());
+
+            std::vector<std::pair<std::string, std::string>> stats = {
+                {"count", toJsonNumber(double(values.size()))}};
+            if (!values.empty()) {
+                const double mean =
+                    std::accumulate(values.begin(), values.end(), 0.0) /
+                    double(values.size());
+                double variance = 0.0;
+                for (const auto value : values) {
+                    variance += (value - mean) * (value - mean);
+                }
+                variance /= double(std::max(values.size(), size_t(2)) - 1);
+
+                stats.emplace_back("mean", toJsonNumber(mean));
+                stats.emplace_back("std", toJsonNumber(std::sqrt(variance)));
+                stats.emplace_back("min", toJsonNumber(values.front()));
+                stats.emplace_back("p25",
+                                   toJsonNumber(getPercentile(values, 0.25)));
+                stats.emplace_back("median",
+                                   toJsonNumber(getPercentile(values, 0.5)));
+                stats.emplace_back("p75",
+                                   toJsonNumber(getPercentile(values, 0.75)));
+                stats.emplace_back("p90",
+                                   toJsonNumber(getPercentile(values, 0.9)));
+                stats.emplace_back("max", toJsonNumber(values.back()));
+            }
+
+            file << (j > 0 ? "," : "") << "\n        "
+                 << toJsonString(benchCase.metricNames[j]) << ": ";
+            writeObject(file, stats, "        ");
+        }
+        file << "\n      }\n    }";
+    }
+    file << "\n  ]\n}\n";
+
+    file.close();
+}
+
+void hrm::BenchmarkRecorder::setEntry(
+    std::vector<std::pair<std::string, std::string>>& object,
+    const std::string& key, const std::string& value) {
+    const auto it = std::find_if(
+        object.begin(), object.end(),
+        [&key](const std::pair<std::string, std::string>& entry) {
+            return entry.first == key;
+        });
+    if (it != object.end()) {
+        it->second = value;
+    } else {
+        object.emplace_back(key, value);
+    }
+}
+
+hrm::BenchmarkMetrics hrm::getPlanningMetrics(const PlanningResult& res,
+                                              const PlannerParameter& param) {
+    const auto& time = res.planningTime;
+    const auto& count = res.operationCount;
+
+    return {{"SUCCESS", double(res.solved)},
+            {"BUILD_TIME", time.buildTime},
+            {"SEARCH_TIME", time.searchTime},
+            {"PLAN_TIME", time.totalTime},
+            {"N_LAYERS", double(param.numSlice)},
+            {"N_X", double(param.numLineX)},
+            {"N_Y", double(param.numLineY)},
+            {"GRAPH_NODE", double(res.graphStructure.vertex.size())},
+            {"GRAPH_EDGE", double(res.graphStructure.edge.size())},
+            {"PATH_NODE", double(res.solutionPath.PathId.size())},
+            {"PATH_COST", res.solutionPath.cost},
+            {"PATH_WAYPOINT", double(res.solutionPath.solvedPath.size())},
+            {"SHORTCUT_TIME", time.shortcutTime},
+            {"MINK_SUM_TIME", time.phaseTime.minkSumTime},
+            {"MESH_TIME", time.phaseTime.meshTime},
+            {"RAY_CAST_TIME", time.phaseTime.rayCastTime},
+            {"FREE_SEGMENT_TIME", time.phaseTime.freeSegmentTime},
+            {"CONNECT_ONE_SLICE_TIME", time.phaseTime.connectOneSliceTime},
+            {"BRIDGE_SLICE_TIME", time.phaseTime.bridgeSliceTime},
+            {"CONNECT_MULTI_SLICE_TIME",
+             time.phaseTime.connectMultiSliceTime},
+            {"N_RAY_CAST", double(count.numRayCast)},
+            {"N_TRIANGLE_TEST", double(count.numTriangleTest)},
+            {"N_TRANSITION_CHECK", double(count.numTransitionCheck)},
+            {"N_BRIDGE_VERTEX", double(count.numBridgeVertex)},
+            {"N_SEARCH_EXPANSION", double(count.numSearchExpansion)}};
+}
@@ -16,6 +16,61 @@ void hrm::displayPlanningTimeInfo(const Time& time) {
     }
 
     std::cout << "Total Planning Time: " << time.totalTime << 's' << std::endl;
+
+    if (time.shortcutTime > 0) {
+        std::cout << "Path shortcut time: " << time.shortcutTime << 's'
+                  << std::endl;
+    }
+
+    // Phases within roadmap building, skipped if not recorded by the planner
+    const std::vector<std::pair<std::string, double>> phases = {
+        {"Minkowski sums", time.phaseTime.minkSumTime},
+        {"Meshing", time.phaseTime.meshTime},
+        {"Sweep-line ray casting", time.phaseTime.rayCastTime},
+        {"Free segments", time.phaseTime.freeSegmentTime},
+        {"Connections within C-slices", time.phaseTime.connectOneSliceTime},
+        {"TFE and bridge C-slices", time.phaseTime.bridgeSliceTime},
+        {"Connections between C-slices",
+         time.phaseTime.connectMultiSliceTime}};
+    for (const auto& phase : phases) {
+        if (phase.second > 0) {
+            std::cout << "  " << phase.first << ": " << phase.second << 's'
+                      << std::endl;
+        }
+    }
+}
+
+void hrm::displayOperationCountInfo(const OperationCount& count) {
+    std::cout << "Number of ray casts: " << count.numRayCast << std::endl;
+    std::cout << "Number of triangle tests: " << count.numTriangleTest
+              << std::endl;
+    std::cout << "Number of transition checks: " << count.numTransitionCheck
+              << std::endl;
+    std::cout << "Number of bridge vertices: " << count.numBridgeVertex
+              << std::endl;
+    std::cout << "Number of search expansions: " << count.numSearchExpansion
+              << std::endl;
+}
+
+void hrm::storeStatisticsHeader(std::ostream& file) {
+    file << ',' << "MINK_SUM_TIME" << ',' << "MESH_TIME" << ','
+         << "RAY_CAST_TIME" << ',' << "FREE_SEGMENT_TIME" << ','
+         << "CONNECT_ONE_SLICE_TIME" << ',' << "BRIDGE_SLICE_TIME" << ','
+         << "CONNECT_MULTI_SLICE_TIME" << ',' << "N_RAY_CAST" << ','
+         << "N_TRIANGLE_TEST" << ',' << "N_TRANSITION_CHECK" << ','
+         << "N_BRIDGE_VERTEX" << ',' << "N_SEARCH_EXPANSION";
+}
+
+void hrm::storeStatistics(const Time& time, const OperationCount& count,
+                          std::ostream& file) {
+    file << ',' << time.phaseTime.minkSumTime << ','
+         << time.phaseTime.meshTime << ',' << time.phaseTime.rayCastTime << ','
+         << time.phaseTime.freeSegmentTime << ','
+         << time.phaseTime.connectOneSliceTime << ','
+         << time.phaseTime.bridgeSliceTime << ','
+         << time.phaseTime.connectMultiSliceTime << ',' << count.numRayCast
+         << ',' << count.numTriangleTest << ',' << count.numTransitionCheck
+         << ',' << count.numBridgeVertex << ',' << count.numSearchExpansion;
 }
 
 void hrm::displayGraphInfo(const Graph& graph) {
@@ -24,23 +79,26 @@ void hrm::displayGraphInfo(const Graph& graph) {
     std::cout << "Number of valid edges: " << graph.edge.size() << std::endl;
 }
 
-void hrm::storeGraphInfo(const Graph& graph, const std::string& suffix) {
-    // Write the output to .csv files
-    std::ofstream fileVtx;
-    fileVtx.open(SOLUTION_DETAILS_PATH "/vertex_" + suffix + ".csv");
-    std::vector<std::vector<double>> vertexList = graph.vertex;
-    for (const auto& vertex : vertexList) {
-        for (const auto& vtx : vertex) {
-            fileVtx << vtx << ',';
-        }
-        fileVtx << "\n";
+void hrm::storeGraphInfo(const Graph& graph, const std::string& suffix,
+                         const DataFileFormat format) {
+    const std::string extension = getDataFileExtension(format);
+
+    DataFileWriter fileVtx(
+        SOLUTION_DETAILS_PATH "/vertex_" + suffix + extension, format);
+    std::vector<double> vertex;
+    for (size_t i = 0; i < graph.vertex.size(); ++i) {
+        graph.vertex.decode(i, vertex);
+        fileVtx.writeRow(vertex);
     }
     fileVtx.close();
 
-    std::ofstream fileEdge;
-    fileEdge.open(SOLUTION_DETAILS_PATH "/edge_" + suffix + ".csv");
-    for (auto edge : graph.edge) {
-        fileEdge << edge.first << ',' << edge.second << "\n";
+    DataFileWriter fileEdge(SOLUTION_DETAILS_PATH "/edge_" + suffix + extension,
+                            format);
+    for (const auto& edge : graph.edge) {
+        const std::uint32_t edgeRow[2] = {
+            static_cast<std::uint32_t>(edge.first),
+            static_cast<std::uint32_t>(edge.second)};
+        fileEdge.writeRow(edgeRow, 2);
     }
     fileEdge.close();
 }
@@ -51,36 +109,33 @@ void hrm::displayPathInfo(const SolutionPathInfo& path) {
 }
 
 void hrm::storePathInfo(const SolutionPathInfo& path,
-                        const std::string& suffix) {
-    // Write the output to .csv files
-    std::ofstream filePathId;
-    filePathId.open(SOLUTION_DETAILS_PATH "/path_id_" + suffix + ".csv");
+                        const std::string& suffix,
+                        const DataFileFormat format) {
+    const std::string extension = getDataFileExtension(format);
+
+    // Indices of path vertices in a single row
+    DataFileWriter filePathId(
+        SOLUTION_DETAILS_PATH "/path_id_" + suffix + extension, format);
     if (!path.PathId.empty()) {
-        for (auto pathId : path.PathId) {
-            filePathId << pathId << ',';
-        }
+        const std::vector<std::uint32_t> pathId(path.PathId.begin(),
+                                                path.PathId.end());
+        filePathId.writeRow(pathId.data(), pathId.size());
     }
     filePathId.close();
 
     // Retrieve solution path
-    std::ofstream filePath;
-    filePath.open(SOLUTION_DETAILS_PATH "/solution_path_" + suffix + ".csv");
+    DataFileWriter filePath(
+        SOLUTION_DETAILS_PATH "/solution_path_" + suffix + extension, format);
     for (const auto& solvedPath : path.solvedPath) {
-        for (const auto& solvedPathVal : solvedPath) {
-            filePath << solvedPathVal << ',';
-        }
-        filePath << "\n";
+        filePath.writeRow(solvedPath);
     }
     filePath.close();
 
-    std::ofstream fileInterpPath;
-    fileInterpPath.open(SOLUTION_DETAILS_PATH "/interpolated_path_" + suffix +
-                        ".csv");
+    DataFileWriter fileInterpPath(
+        SOLUTION_DETAILS_PATH "/interpolated_path_" + suffix + extension,
+        format);
     for (const auto& interpPath : path.interpolatedPath) {
-        for (const auto& interpPathVal : interpPath) {
-            fileInterpPath << interpPathVal << ',';
-        }
-        fileInterpPath << "\n";
+        fileInterpPath.writeRow(interpPath);
     }
     fileInterpPath.close();
 }
@@ -19,7 +19,7 @@ void loadVectorGeometry(const std::string& configFilename,
                         const int numCurvePoint,
                         std::vector<SuperEllipse>& object) {
     std::vector<std::vector<double>> objectConfig =
-        parse2DCsvFile(configFilename);
+        parse2DDataFile(configFilename);
 
     loadVectorGeometry(objectConfig, numCurvePoint, object);
 }
@@ -42,7 +42,7 @@ void loadVectorGeometry(const std::string& configFilename,
                         const int numSurfPointParam,
                         std::vector<SuperQuadrics>& object) {
     std::vector<std::vector<double>> objectConfig =
-        parse2DCsvFile(configFilename);
+        parse2DDataFile(configFilename);
 
     loadVectorGeometry(objectConfig, numSurfPointParam, object);
 }
@@ -86,11 +86,11 @@ void loadPreDefinedQuaternions(const std::string& quaternionFilename,
                                SuperQuadrics& robotBase) {
     // Read predefined quaternions
     if (quaternionFilename == "0") {
-        std::cout << "Will generate uniform random rotations from SO(3)"
+        std::cout << "Will generate uniform grid of rotations from SO(3)"
                   << std::endl;
     } else {
         std::vector<std::vector<double>> quatSampleList =
-            parse2DCsvFile(quaternionFilename);
+            parse2DDataFile(quaternionFilename);
 
         std::vector<Eigen::Quaterniond> qSample;
         for (auto sample : quatSampleList) {
@@ -186,11 +186,11 @@ void parsePlanningConfig(const std::string& objectType,
 
 void parseGeometricModel(const std::string& inputFilename,
                          const std::string& outputFilename) {
-    const auto objects = parse2DCsvFile(inputFilename);
+    auto objects = parse2DDataFile(inputFilename);
 
     std::ofstream fileConfig;
     fileConfig.open(outputFilename);
-    for (const auto& object : objects) {
+    for (auto& object : objects) {
         // For 3D superquadric model
         if (object.size() == 12) {
             // Convert angle-axis to Quaternion representation
@@ -198,27 +198,29 @@ void parseGeometricModel(const std::string& inputFilename,
             axis.normalize();
             Eigen::Quaterniond quat(Eigen::AngleAxisd(object.at(11), axis));
 
-            // Write into config .csv file in /config folder
-            fileConfig << object.at(0) << ',' << object.at(1) << ','
-                       << object.at(2) << ',' << object.at(3) << ','
-                       << object.at(4) << ',' << object.at(5) << ','
-                       << object.at(6) << ',' << object.at(7) << ',' << quat.w()
-                       << ',' << quat.x() << ',' << quat.y() << ',' << quat.z()
-                       << "\n";
-        } else {
-            for (size_t i = 0; i < object.size() - 1; ++i) {
-                fileConfig << object.at(i) << ',';
-            }
-            fileConfig << object.back() << "\n";
+            object.at(8) = quat.w();
+            object.at(9) = quat.x();
+            object.at(10) = quat.y();
+            object.at(11) = quat.z();
+        }
+
+        // Write into config .csv file in /config folder
+        for (size_t i = 0; i < object.size() - 1; ++i) {
+            fileConfig << object.at(i) << ',';
         }
+        fileConfig << object.back() << "\n";
     }
     fileConfig.close();
+
+    // Binary copy in full precision for loading
+    write2DBinaryFile(objects, getBinaryFilename(outputFilename));
 }
 
 void parseStartGoalConfig(const std::string& robotType, const std::string& dim,
                           const std::string& inputFilename,
                           const std::string& outputFilename) {
-    const auto configs = parse2DCsvFile(inputFilename);
+    const auto configs = parse2DDataFile(inputFilename);
+    std::vector<std::vector<double>> endPoints;
 
     std::ofstream fileConfig;
     fileConfig.open(outputFilename);
@@ -227,6 +229,7 @@ void parseStartGoalConfig(const std::string& robotType, const std::string& dim,
             // For 2D case
             fileConfig << config.at(0) << ',' << config.at(1) << ','
                        << config.at(2) << "\n";
+            endPoints.push_back({config.at(0), config.at(1), config.at(2)});
 
         } else if (dim == "3D") {
             // For 3D case
@@ -255,11 +258,15 @@ void parseStartGoalConfig(const std::string& robotType, const std::string& dim,
                 fileConfig << config.at(i) << ',';
             }
             fileConfig << config.at(numDOF) << "\n";
+            endPoints.emplace_back(config.begin(),
+                                   config.begin() + numDOF + 1);
         } else {
             std::cerr << "Only '2D' and '3D' are supported." << std::endl;
         }
     }
     fileConfig.close();
+
+    write2DBinaryFile(endPoints, getBinaryFilename(outputFilename));
 }
 
 }  // namespace hrm
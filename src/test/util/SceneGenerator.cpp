@@ -0,0 +1,242 @@
+/** \author Sipu Ruan */
+
+#include "hrm/test/util/SceneGenerator.h"
+
+#include <cmath>
+#include <fstream>
+#include <random>
+
+namespace {
+
+/** \brief Exponent of box-like superquadrics for arena and walls */
+const double BOX_EPSILON = 0.1;
+
+/** \brief Portable uniform sampler. The output of std::mt19937 is fully
+ * specified by the standard while std::uniform_real_distribution is not */
+class UniformSampler {
+  public:
+    UniformSampler(const unsigned int seed) : generator_(seed) {}
+
+    double sample(const double low, const double high) {
+        return low + (high - low) * double(generator_()) / 4294967296.0;
+    }
+
+    /** \brief Uniform rotation axis, by rejection in the unit ball */
+    std::vector<double> sampleAxis() {
+        while (true) {
+            std::vector<double> axis = {sample(-1.0, 1.0), sample(-1.0, 1.0),
+                                        sample(-1.0, 1.0)};
+            const double norm =
+                std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] +
+                          axis[2] * axis[2]);
+            if (norm > 1e-3 && norm <= 1.0) {
+                for (auto& a : axis) {
+                    a /= norm;
+                }
+                return axis;
+            }
+        }
+    }
+
+  private:
+    std::mt19937 generator_;
+};
+
+/** \brief Row of box-like object in resource format
+ * \param center Center of the box
+ * \param half Half extents of the box */
+std::vector<double> getBoxRow(const std::vector<double>& center,
+                              const std::vector<double>& half) {
+    if (center.size() == 2) {
+        return {half[0], half[1], BOX_EPSILON, center[0], center[1], 0.0};
+    }
+
+    return {half[0],   half[1],   half[2],   BOX_EPSILON, BOX_EPSILON,
+            center[0], center[1], center[2], 0.0,         0.0,
+            1.0,       0.0};
+}
+
+/** \brief Add box spanning an interval along one axis, skipped if the
+ * interval is empty */
+void addWallPiece(std::vector<double> center, std::vector<double> half,
+                  const size_t axis, const double low, const double high,
+                  std::vector<std::vector<double>>& obstacle) {
+    if (high - low <= 0.0) {
+        return;
+    }
+
+    center.at(axis) = 0.5 * (low + high);
+    half.at(axis) = 0.5 * (high - low);
+    obstacle.push_back(getBoxRow(center, half));
+}
+
+hrm::SceneDescription generateScene(const hrm::SceneParameter& param,
+                                    const size_t dim) {
+    hrm::SceneDescription scene;
+    UniformSampler sampler(param.seed);
+
+    const std::vector<double> arenaSemiAxis(param.arenaSemiAxis.begin(),
+                                            param.arenaSemiAxis.begin() + dim);
+    scene.arena.push_back(
+        getBoxRow(std::vector<double>(dim, 0.0), arenaSemiAxis));
+
+    // Start and goal at two ends of x-axis
+    std::vector<std::vector<double>> endCenter;
+    for (const double x : {-0.8 * arenaSemiAxis[0], 0.8 * arenaSemiAxis[0]}) {
+        std::vector<double> center = {x};
+        for (size_t k = 1; k < dim; ++k) {
+            center.push_back(sampler.sample(-0.6 * arenaSemiAxis[k],
+                                            0.6 * arenaSemiAxis[k]));
+        }
+
+        auto endPoint = center;
+        if (dim == 2) {
+            endPoint.push_back(sampler.sample(-hrm::PI, hrm::PI));
+        } else {
+            const auto axis = sampler.sampleAxis();
+            endPoint.insert(endPoint.end(), axis.begin(), axis.end());
+            endPoint.push_back(sampler.sample(0.0, hrm::PI));
+        }
+
+        endCenter.push_back(center);
+        scene.endPoints.push_back(endPoint);
+    }
+
+    // Walls between start and goal, each with one passage. The walls exceed
+    // the arena to seal the rounded corners
+    const double w = 0.5 * param.passageWidth;
+    const double t = 0.5 * param.wallThickness;
+    std::vector<double> wallX;
+    for (size_t i = 0; i < param.numPassage; ++i) {
+        const double x = -0.8 * arenaSemiAxis[0] +
+                         1.6 * arenaSemiAxis[0] * double(i + 1) /
+                             double(param.numPassage + 1);
+        wallX.push_back(x);
+
+        std::vector<double> passage = {x};
+        std::vector<double> bound = {t};
+        for (size_t k = 1; k < dim; ++k) {
+            passage.push_back(sampler.sample(-0.6 * arenaSemiAxis[k],
+                                             0.6 * arenaSemiAxis[k]));
+            bound.push_back(1.1 * arenaSemiAxis[k]);
+        }
+
+        // Pieces on both sides of the passage along y-axis, spanning z-axis
+        addWallPiece(passage, bound, 1, -bound[1], passage[1] - w,
+                     scene.obstacle);
+        addWallPiece(passage, bound, 1, passage[1] + w, bound[1],
+                     scene.obstacle);
+
+        // Pieces on both sides of the passage along z-axis in 3D
+        if (dim == 3) {
+            std::vector<double> half = bound;
+            half[1] = w;
+            addWallPiece(passage, half, 2, -bound[2], passage[2] - w,
+                         scene.obstacle);
+            addWallPiece(passage, half, 2, passage[2] + w, bound[2],
+                         scene.obstacle);
+        }
+    }
+
+    // Random obstacles, resampled if blocking walls or end points
+    const hrm::Index maxNumAttempt = 100;
+    for (size_t i = 0; i < param.numObstacle; ++i) {
+        for (hrm::Index attempt = 0; attempt < maxNumAttempt; ++attempt) {
+            std::vector<double> semiAxis;
+            double radius = 0.0;
+            for (size_t k = 0; k < dim; ++k) {
+                semiAxis.push_back(sampler.sample(param.minObstacleSize,
+                                                  param.maxObstacleSize));
+                radius = std::fmax(radius, semiAxis.back());
+            }
+
+            std::vector<double> center;
+            for (size_t k = 0; k < dim; ++k) {
+                center.push_back(
+                    sampler.sample(-arenaSemiAxis[k], arenaSemiAxis[k]));
+            }
+
+            bool isBlocking = false;
+            for (const auto& end : endCenter) {
+                double dist = 0.0;
+                for (size_t k = 0; k < dim; ++k) {
+                    dist += (center[k] - end[k]) * (center[k] - end[k]);
+                }
+                if (std::sqrt(dist) < radius + param.endPointClearance) {
+                    isBlocking = true;
+                }
+            }
+            for (const auto x : wallX) {
+                if (std::fabs(center[0] - x) < radius + t) {
+                    isBlocking = true;
+                }
+            }
+            if (isBlocking) {
+                continue;
+            }
+
+            std::vector<double> row = semiAxis;
+            if (dim == 2) {
+                row.push_back(sampler.sample(0.1, 1.9));
+                row.insert(row.end(), center.begin(), center.end());
+                row.push_back(sampler.sample(-hrm::PI, hrm::PI));
+            } else {
+                row.push_back(sampler.sample(0.1, 1.9));
+                row.push_back(sampler.sample(0.1, 1.9));
+                row.insert(row.end(), center.begin(), center.end());
+                const auto axis = sampler.sampleAxis();
+                row.insert(row.end(), axis.begin(), axis.end());
+                row.push_back(sampler.sample(0.0, hrm::PI));
+            }
+            scene.obstacle.push_back(row);
+            break;
+        }
+    }
+
+    return scene;
+}
+
+/** \brief Write rows into .csv file */
+void storeRows(const std::vector<std::vector<double>>& rows,
+               const std::string& filename) {
+    std::ofstream file;
+    file.open(filename);
+    file.precision(10);
+    for (const auto& row : rows) {
+        for (size_t i = 0; i < row.size(); ++i) {
+            file << row[i] << (i + 1 < row.size() ? ',' : '\n');
+        }
+    }
+    file.close();
+}
+
+}  // namespace
+
+hrm::SceneDescription hrm::generateScene3D(const SceneParameter& param) {
+    return generateScene(param, 3);
+}
+
+hrm::SceneDescription hrm::generateScene2D(const SceneParameter& param) {
+    return generateScene(param, 2);
+}
+
+void hrm::storeScene(const SceneDescription& scene,
+                     const std::string& objectType,
+                     const std::string& sceneName, const std::string& dim,
+                     const std::string& path) {
+    const std::string prefix = path + "/env_" + objectType + "_" + sceneName +
+                               "_" + dim;
+    storeRows(scene.arena, prefix + "_arena.csv");
+    storeRows(scene.obstacle, prefix + "_obstacle.csv");
+
+    // Zero joint angles, enough for all the articulated robots in resources
+    const size_t numJoint = 9;
+    auto endPoints = scene.endPoints;
+    if (dim == "3D") {
+        for (auto& endPoint : endPoints) {
+            endPoint.resize(endPoint.size() + numJoint, 0.0);
+        }
+    }
+    storeRows(endPoints, path + "/setting_" + objectType + "_" + sceneName +
+                             "_" + dim + ".csv");
+}
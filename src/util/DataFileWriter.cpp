@@ -0,0 +1,131 @@
+/** \author Sipu Ruan */
+
+#include "hrm/util/DataFileWriter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+const char MAGIC[8] = {'H', 'R', 'M', 'M', 'A', 'T', '0', '1'};
+
+/** \brief Type codes of entries in binary format */
+const std::uint64_t TYPE_DOUBLE = 0;
+const std::uint64_t TYPE_UINT32 = 1;
+
+/** \brief Maximum number of characters of a number and a separator */
+const size_t MAX_CHAR_NUMBER = 32;
+
+}  // namespace
+
+std::string hrm::getDataFileExtension(const DataFileFormat format) {
+    return format == DataFileFormat::BINARY ? ".bin" : ".csv";
+}
+
+hrm::DataFileWriter::DataFileWriter(const std::string& filename,
+                                    const DataFileFormat format,
+                                    const size_t bufferSize)
+    : file_(filename, std::ios::binary),
+      filename_(filename),
+      format_(format),
+      buffer_(std::max(bufferSize, MAX_CHAR_NUMBER)) {
+    if (!file_) {
+        throw std::invalid_argument("Could not write file " + filename_);
+    }
+
+    // Header with sizes completed when closing
+    if (format_ == DataFileFormat::BINARY) {
+        const std::uint64_t header[3] = {0, 0, TYPE_DOUBLE};
+        file_.write(MAGIC, sizeof(MAGIC));
+        file_.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+}
+
+hrm::DataFileWriter::~DataFileWriter() {
+    try {
+        close();
+    } catch (const std::exception& e) {
+        e.what();
+    }
+}
+
+void hrm::DataFileWriter::writeRow(const double* row, const size_t size) {
+    writeEntries(row, size, TYPE_DOUBLE);
+}
+
+void hrm::DataFileWriter::writeRow(const std::uint32_t* row,
+                                   const size_t size) {
+    writeEntries(row, size, TYPE_UINT32);
+}
+
+void hrm::DataFileWriter::close() {
+    if (!file_.is_open()) {
+        return;
+    }
+
+    flush();
+    if (format_ == DataFileFormat::BINARY) {
+        const std::uint64_t header[3] = {numRow_, numCol_, type_};
+        file_.seekp(sizeof(MAGIC));
+        file_.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+
+    const bool isGood = file_.good();
+    file_.close();
+    if (!isGood) {
+        throw std::invalid_argument("Could not write file " + filename_);
+    }
+}
+
+template <typename T>
+void hrm::DataFileWriter::writeEntries(const T* row, const size_t size,
+                                       const std::uint64_t type) {
+    if (format_ == DataFileFormat::BINARY) {
+        if (numRow_ == 0) {
+            numCol_ = size;
+            type_ = type;
+        } else if (size != numCol_ || type != type_) {
+            throw std::invalid_argument("Rows of different sizes in file " +
+                                        filename_);
+        }
+
+        const size_t numByte = size * sizeof(T);
+        if (bufferUsed_ + numByte > buffer_.size()) {
+            flush();
+        }
+        if (numByte > buffer_.size()) {
+            file_.write(reinterpret_cast<const char*>(row), numByte);
+        } else {
+            std::memcpy(buffer_.data() + bufferUsed_, row, numByte);
+            bufferUsed_ += numByte;
+        }
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            if (bufferUsed_ + MAX_CHAR_NUMBER > buffer_.size()) {
+                flush();
+            }
+
+            char* ptr = buffer_.data() + bufferUsed_;
+            ptr = std::to_chars(ptr, ptr + MAX_CHAR_NUMBER - 1, row[i]).ptr;
+            *ptr++ = (i + 1 < size) ? ',' : '\n';
+            bufferUsed_ = ptr - buffer_.data();
+        }
+
+        // Empty line for an empty row
+        if (size == 0) {
+            if (bufferUsed_ + 1 > buffer_.size()) {
+                flush();
+            }
+            buffer_[bufferUsed_++] = '\n';
+        }
+    }
+
+    numRow_++;
+}
+
+void hrm::DataFileWriter::flush() {
+    file_.write(buffer_.data(), bufferUsed_);
+    bufferUsed_ = 0;
+}
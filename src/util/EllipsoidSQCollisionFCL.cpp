@@ -2,7 +2,54 @@
 
 #include "hrm/util/EllipsoidSQCollisionFCL.h"
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 using GeometryPtr = std::shared_ptr<fcl::CollisionGeometry<double>>;
+using GeometryWeakPtr = std::weak_ptr<fcl::CollisionGeometry<double>>;
+
+namespace {
+
+/** \brief BVH model of the superquadric mesh. Models only depend on the
+ * shape, and are shared by all the collision objects of the same shape. The
+ * cache does not own the models, which are released together with the last
+ * collision object using them */
+GeometryPtr getBVHModelFromSQ(const hrm::SuperQuadrics& object) {
+    static std::map<std::vector<double>, GeometryWeakPtr> modelAll;
+    static std::mutex modelMutex;
+
+    std::vector<double> key = object.getSemiAxis();
+    key.insert(key.end(), object.getEpsilon().begin(),
+               object.getEpsilon().end());
+    key.push_back(static_cast<double>(object.getNumParam()));
+
+    std::lock_guard<std::mutex> lock(modelMutex);
+    if (GeometryPtr modelShared = modelAll[key].lock()) {
+        return modelShared;
+    }
+
+    // Drop the models that have been released
+    for (auto it = modelAll.begin(); it != modelAll.end();) {
+        if (it->second.expired()) {
+            it = modelAll.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    const hrm::Mesh objMesh = hrm::getMeshFromSQ(object);
+    auto modelPtr = std::make_shared<fcl::BVHModel<fcl::OBBRSS<double>>>();
+    modelPtr->beginModel(static_cast<int>(objMesh.triangles.size()),
+                         static_cast<int>(objMesh.vertices.size()));
+    modelPtr->addSubModel(objMesh.vertices, objMesh.triangles);
+    modelPtr->endModel();
+
+    modelAll[key] = modelPtr;
+    return modelPtr;
+}
+
+}  // namespace
 
 bool hrm::isCollision(const SuperQuadrics& object1,
                       fcl::CollisionObject<double> collisionObject1,
@@ -64,13 +111,7 @@ fcl::CollisionObject<double> hrm::setCollisionObjectFromSQ(
     }
 
     // Mesh model
-    const Mesh objMesh = getMeshFromSQ(object);
-    auto modelPtr = std::make_shared<fcl::BVHModel<fcl::OBBRSS<double>>>();
-    modelPtr->beginModel();
-    modelPtr->addSubModel(objMesh.vertices, objMesh.triangles);
-    modelPtr->endModel();
-
-    return fcl::CollisionObject<double>(GeometryPtr(modelPtr));
+    return fcl::CollisionObject<double>(getBVHModelFromSQ(object));
 }
 
 fcl::CollisionObject<double> hrm::setCollisionObjectFromSQ(
@@ -88,11 +129,6 @@ fcl::CollisionObject<double> hrm::setCollisionObjectFromSQ(
         {object.getSemiAxis().at(0), object.getSemiAxis().at(1), 0.1},
         {object.getEpsilon(), 0.1}, {0.0, 0.0, 0.0},
         Eigen::Quaterniond::Identity(), 10);
-    const Mesh objMesh = getMeshFromSQ(objAux);
-    auto modelPtr = std::make_shared<fcl::BVHModel<fcl::OBBRSS<double>>>();
-    modelPtr->beginModel();
-    modelPtr->addSubModel(objMesh.vertices, objMesh.triangles);
-    modelPtr->endModel();
 
-    return fcl::CollisionObject<double>(GeometryPtr(modelPtr));
+    return fcl::CollisionObject<double>(getBVHModelFromSQ(objAux));
 }
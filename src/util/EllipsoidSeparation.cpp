@@ -2,8 +2,78 @@
 
 #include "hrm/util/EllipsoidSeparation.h"
 
+#include <Eigen/Eigenvalues>
+
+#include <algorithm>
 #include <iostream>
 
+namespace {
+
+/** \brief Separation condition of two ellipsoids, using fixed-size storage
+ * \param a Diagonal of the quadric matrix of ellipsoid A in its body frame
+ * \param b Quadric matrix of ellipsoid B in body frame of ellipsoid A
+ * \return true if separated */
+bool isQuadricSeparated(const Eigen::Vector3d& a, const Eigen::Matrix4d& b) {
+    const double a11 = a(0);
+    const double a22 = a(1);
+    const double a33 = a(2);
+
+    // Coefficients of the characteristic polynomial det(lambda*A - b)
+    const double T4 = -a11 * a22 * a33;
+    const double T3 = a11 * a22 * b(2, 2) + a11 * a33 * b(1, 1) +
+                      a22 * a33 * b(0, 0) - a11 * a22 * a33 * b(3, 3);
+    const double T2 =
+        a11 * b(1, 2) * b(2, 1) - a11 * b(1, 1) * b(2, 2) -
+        a22 * b(0, 0) * b(2, 2) + a22 * b(0, 2) * b(2, 0) -
+        a33 * b(0, 0) * b(1, 1) + a33 * b(0, 1) * b(1, 0) +
+        a11 * a22 * b(2, 2) * b(3, 3) - a11 * a22 * b(2, 3) * b(3, 2) +
+        a11 * a33 * b(1, 1) * b(3, 3) - a11 * a33 * b(1, 3) * b(3, 1) +
+        a22 * a33 * b(0, 0) * b(3, 3) - a22 * a33 * b(0, 3) * b(3, 0);
+
+    // Determinants of 3x3 minors of b that remove the i-th row and column
+    const Eigen::Matrix3d b123 = b.topLeftCorner<3, 3>();
+    Eigen::Matrix3d b234;
+    Eigen::Matrix3d b134;
+    Eigen::Matrix3d b124;
+    const int id234[3] = {1, 2, 3};
+    const int id134[3] = {0, 2, 3};
+    const int id124[3] = {0, 1, 3};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            b234(i, j) = b(id234[i], id234[j]);
+            b134(i, j) = b(id134[i], id134[j]);
+            b124(i, j) = b(id124[i], id124[j]);
+        }
+    }
+    const double T1 = b123.determinant() - a11 * b234.determinant() -
+                      a22 * b134.determinant() - a33 * b124.determinant();
+    const double T0 = b.determinant();
+
+    // Roots as eigenvalues of the companion matrix
+    Eigen::Matrix4d companion = Eigen::Matrix4d::Zero();
+    companion.bottomLeftCorner<3, 3>().setIdentity();
+    companion(0, 0) = -T3 / T4;
+    companion(0, 1) = -T2 / T4;
+    companion(0, 2) = -T1 / T4;
+    companion(0, 3) = -T0 / T4;
+
+    const Eigen::EigenSolver<Eigen::Matrix4d> solver(companion, false);
+    const Eigen::Vector4cd roots = solver.eigenvalues();
+
+    // Separated iff two distinct real negative roots
+    int numNegRoot = 0;
+    std::complex<double> negRoot[4];
+    for (int i = 0; i < 4; ++i) {
+        if (std::fabs(roots(i).imag()) < 1e-6 && roots(i).real() < 0) {
+            negRoot[numNegRoot++] = roots(i);
+        }
+    }
+
+    return numNegRoot == 2 && std::abs(negRoot[0] - negRoot[1]) > 1e-6;
+}
+
+}  // namespace
+
 bool hrm::isEllipsoidSeparated(const SuperQuadrics& ellipsoidA,
                                const SuperQuadrics& ellipsoidB) {
     // Semi-axis
@@ -217,3 +287,99 @@ std::vector<std::complex<double>> hrm::getRootsPolynomial(
 
     return vret;
 }
+
+hrm::EllipsoidBatch hrm::getEllipsoidBatch(
+    const std::vector<SuperQuadrics>& ellipsoids) {
+    EllipsoidBatch batch;
+
+    for (const auto& ellipsoid : ellipsoids) {
+        const auto& semiAxis = ellipsoid.getSemiAxis();
+        batch.centerX.push_back(ellipsoid.getPosition().at(0));
+        batch.centerY.push_back(ellipsoid.getPosition().at(1));
+        batch.centerZ.push_back(ellipsoid.getPosition().at(2));
+        batch.radiusOuter.push_back(
+            *std::max_element(semiAxis.begin(), semiAxis.end()));
+        batch.radiusInner.push_back(
+            *std::min_element(semiAxis.begin(), semiAxis.end()));
+
+        // Quadric matrix in world frame
+        Eigen::Matrix4d tfInv = Eigen::Matrix4d::Identity();
+        const Eigen::Matrix3d rot =
+            ellipsoid.getQuaternion().toRotationMatrix();
+        tfInv.topLeftCorner(3, 3) = rot.transpose();
+        tfInv.topRightCorner(3, 1) =
+            -rot.transpose() * Eigen::Vector3d(ellipsoid.getPosition().data());
+
+        const Eigen::Vector4d diag(std::pow(semiAxis.at(0), -2.0),
+                                   std::pow(semiAxis.at(1), -2.0),
+                                   std::pow(semiAxis.at(2), -2.0), -1.0);
+        const Eigen::Matrix4d quadric =
+            tfInv.transpose() * diag.asDiagonal() * tfInv;
+
+        int k = 0;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = i; j < 4; ++j) {
+                batch.quadric[k++].push_back(quadric(i, j));
+            }
+        }
+    }
+
+    return batch;
+}
+
+bool hrm::isEllipsoidSeparated(const Eigen::Vector3d& semiAxisA,
+                               const Eigen::Matrix4d& poseA,
+                               const EllipsoidBatch& ellipsoidsB) {
+    const Eigen::Vector3d a = semiAxisA.array().pow(-2.0);
+    const double radiusOuterA = semiAxisA.maxCoeff();
+    const double radiusInnerA = semiAxisA.minCoeff();
+    const double x = poseA(0, 3);
+    const double y = poseA(1, 3);
+    const double z = poseA(2, 3);
+
+    Eigen::Matrix4d quadric;
+    for (std::size_t i = 0; i < ellipsoidsB.size(); ++i) {
+        const double dx = ellipsoidsB.centerX[i] - x;
+        const double dy = ellipsoidsB.centerY[i] - y;
+        const double dz = ellipsoidsB.centerZ[i] - z;
+        const double dist2 = dx * dx + dy * dy + dz * dz;
+
+        // Bounding spheres are separated
+        const double radiusOuter = radiusOuterA + ellipsoidsB.radiusOuter[i];
+        if (dist2 > radiusOuter * radiusOuter) {
+            continue;
+        }
+
+        // Inscribed spheres overlap
+        const double radiusInner = radiusInnerA + ellipsoidsB.radiusInner[i];
+        if (dist2 < radiusInner * radiusInner) {
+            return false;
+        }
+
+        // Quadric of ellipsoid B in body frame of ellipsoid A
+        int k = 0;
+        for (int r = 0; r < 4; ++r) {
+            for (int c = r; c < 4; ++c) {
+                quadric(r, c) = ellipsoidsB.quadric[k++][i];
+                quadric(c, r) = quadric(r, c);
+            }
+        }
+
+        if (!isQuadricSeparated(a, poseA.transpose() * quadric * poseA)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool hrm::isEllipsoidSeparated(const SuperQuadrics& ellipsoidA,
+                               const EllipsoidBatch& ellipsoidsB) {
+    Eigen::Matrix4d poseA = Eigen::Matrix4d::Identity();
+    poseA.topLeftCorner(3, 3) = ellipsoidA.getQuaternion().toRotationMatrix();
+    poseA.topRightCorner(3, 1) =
+        Eigen::Vector3d(ellipsoidA.getPosition().data());
+
+    return isEllipsoidSeparated(
+        Eigen::Vector3d(ellipsoidA.getSemiAxis().data()), poseA, ellipsoidsB);
+}
@@ -0,0 +1,194 @@
+/** \author Sipu Ruan */
+
+#include "hrm/util/ObstacleCollisionManager.h"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/** \brief Data passed through broad-phase query */
+struct CollisionData {
+    /** \brief Narrow-phase request, stops at the first contact */
+    fcl::CollisionRequest<double> request;
+
+    /** \brief Narrow-phase result, reused for each candidate pair */
+    fcl::CollisionResult<double>* result;
+
+    /** \brief Indicator of collision */
+    bool isCollision = false;
+};
+
+/** \brief Narrow phase for candidate pairs, returns true to stop the query */
+bool collisionCallback(fcl::CollisionObject<double>* o1,
+                       fcl::CollisionObject<double>* o2, void* data) {
+    auto* collisionData = static_cast<CollisionData*>(data);
+    if (collisionData->isCollision) {
+        return true;
+    }
+
+    collisionData->result->clear();
+    fcl::collide(o1, o2, collisionData->request, *collisionData->result);
+    collisionData->isCollision = collisionData->result->isCollision();
+
+    return collisionData->isCollision;
+}
+
+/** \brief Data passed through broad-phase distance query */
+struct DistanceData {
+    /** \brief Narrow-phase request */
+    fcl::DistanceRequest<double> request;
+
+    /** \brief Narrow-phase result, reused for each candidate pair */
+    fcl::DistanceResult<double>* result;
+
+    /** \brief Minimum distance among checked pairs */
+    double minDistance = std::numeric_limits<double>::infinity();
+};
+
+/** \brief Narrow-phase distance for candidate pairs, the manager prunes the
+ * pairs farther than dist. Returns true to stop the query */
+bool distanceCallback(fcl::CollisionObject<double>* o1,
+                      fcl::CollisionObject<double>* o2, void* data,
+                      double& dist) {
+    auto* distanceData = static_cast<DistanceData*>(data);
+
+    distanceData->result->clear();
+    fcl::distance(o1, o2, distanceData->request, *distanceData->result);
+    distanceData->minDistance = std::fmin(
+        distanceData->minDistance,
+        std::fmax(distanceData->result->min_distance, 0.0));
+    dist = distanceData->minDistance;
+
+    return dist <= 0.0;
+}
+
+/** \brief Data passed through broad-phase query of a moving body */
+struct ContinuousCollisionData {
+    /** \brief Object bounding the swept volume, used by broad phase */
+    const fcl::CollisionObject<double>* sweptObject;
+
+    /** \brief Collision geometry of the moving body */
+    const fcl::CollisionGeometry<double>* geometry;
+
+    /** \brief Start pose of the moving body */
+    const fcl::Transform3d* tfStart;
+
+    /** \brief Goal pose of the moving body */
+    const fcl::Transform3d* tfGoal;
+
+    /** \brief Continuous collision request */
+    fcl::ContinuousCollisionRequest<double> request;
+
+    /** \brief Indicator of collision */
+    bool isCollision = false;
+};
+
+/** \brief Continuous collision for candidate pairs, returns true to stop the
+ * query */
+bool continuousCollisionCallback(fcl::CollisionObject<double>* o1,
+                                 fcl::CollisionObject<double>* o2,
+                                 void* data) {
+    auto* collisionData = static_cast<ContinuousCollisionData*>(data);
+    if (collisionData->isCollision) {
+        return true;
+    }
+
+    // Order of the pair is not specified by the manager
+    const auto* obstacle = o1 == collisionData->sweptObject ? o2 : o1;
+
+    fcl::ContinuousCollisionResult<double> result;
+    fcl::continuousCollide(
+        collisionData->geometry, *collisionData->tfStart,
+        *collisionData->tfGoal, obstacle->collisionGeometry().get(),
+        obstacle->getTransform(), obstacle->getTransform(),
+        collisionData->request, result);
+    collisionData->isCollision = result.is_collide;
+
+    return collisionData->isCollision;
+}
+
+}  // namespace
+
+hrm::ObstacleCollisionManager::ObstacleCollisionManager()
+    : manager_(
+          std::make_unique<fcl::DynamicAABBTreeCollisionManager<double>>()) {}
+
+hrm::ObstacleCollisionManager::~ObstacleCollisionManager() = default;
+
+void hrm::ObstacleCollisionManager::setObstacles(
+    std::vector<fcl::CollisionObject<double>>& objObs) {
+    std::vector<fcl::CollisionObject<double>*> objPtr;
+    for (auto& obj : objObs) {
+        objPtr.push_back(&obj);
+    }
+
+    setObstacles(objPtr);
+}
+
+void hrm::ObstacleCollisionManager::setObstacles(
+    const std::vector<fcl::CollisionObject<double>*>& objObs) {
+    for (auto* obj : objObs) {
+        obj->computeAABB();
+    }
+
+    manager_->clear();
+    manager_->registerObjects(objObs);
+    manager_->setup();
+}
+
+bool hrm::ObstacleCollisionManager::isCollision(
+    const std::shared_ptr<fcl::CollisionGeometry<double>>& geometry,
+    const fcl::Transform3d& tf) const {
+    // Query object with bounding box at the current pose
+    fcl::CollisionObject<double> obj(geometry, tf);
+
+    thread_local fcl::CollisionResult<double> result;
+    CollisionData data;
+    data.result = &result;
+    manager_->collide(&obj, &data, collisionCallback);
+
+    return data.isCollision;
+}
+
+bool hrm::ObstacleCollisionManager::isContinuousCollision(
+    const std::shared_ptr<fcl::CollisionGeometry<double>>& geometry,
+    const fcl::Transform3d& tfStart, const fcl::Transform3d& tfGoal) const {
+    // Sphere bounding the body at both poses, reused within each thread
+    const fcl::Vector3d centerStart = tfStart * geometry->aabb_center;
+    const fcl::Vector3d centerGoal = tfGoal * geometry->aabb_center;
+
+    thread_local auto sweptSphere = std::make_shared<fcl::Sphered>(1.0);
+    sweptSphere->radius =
+        0.5 * (centerGoal - centerStart).norm() + geometry->aabb_radius;
+    sweptSphere->computeLocalAABB();
+
+    fcl::Transform3d tfSwept = fcl::Transform3d::Identity();
+    tfSwept.translation() = 0.5 * (centerStart + centerGoal);
+    fcl::CollisionObject<double> sweptObject(sweptSphere, tfSwept);
+
+    // Conservative advancement between the static obstacles and the body
+    ContinuousCollisionData data;
+    data.sweptObject = &sweptObject;
+    data.geometry = geometry.get();
+    data.tfStart = &tfStart;
+    data.tfGoal = &tfGoal;
+    data.request.ccd_motion_type = fcl::CCDM_LINEAR;
+    data.request.ccd_solver_type = fcl::CCDC_CONSERVATIVE_ADVANCEMENT;
+    manager_->collide(&sweptObject, &data, continuousCollisionCallback);
+
+    return data.isCollision;
+}
+
+double hrm::ObstacleCollisionManager::getDistance(
+    const std::shared_ptr<fcl::CollisionGeometry<double>>& geometry,
+    const fcl::Transform3d& tf) const {
+    fcl::CollisionObject<double> obj(geometry, tf);
+
+    thread_local fcl::DistanceResult<double> result;
+    DistanceData data;
+    data.result = &result;
+    manager_->distance(&obj, &data, distanceCallback);
+
+    return data.minDistance;
+}
@@ -0,0 +1,186 @@
+/** \author Sipu Ruan */
+
+#include "hrm/util/Parse2dBinaryFile.h"
+#include "hrm/util/Parse2dCsvFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+namespace {
+
+const char MAGIC[8] = {'H', 'R', 'M', 'B', 'I', 'N', '0', '1'};
+
+/** \brief Magic string of dense matrices from DataFileWriter */
+const char MAGIC_MATRIX[8] = {'H', 'R', 'M', 'M', 'A', 'T', '0', '1'};
+
+/** \brief Read-only memory map of a whole file, unmapped on destruction */
+class MappedFile {
+  public:
+    MappedFile(const std::string& filename) {
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::invalid_argument("Could not read file " + filename);
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            size_ = static_cast<size_t>(info.st_size);
+            void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                data_ = static_cast<const char*>(data);
+            }
+        }
+        close(fd);
+
+        if (data_ == nullptr) {
+            throw std::invalid_argument("Could not map file " + filename);
+        }
+    }
+
+    ~MappedFile() { munmap(const_cast<char*>(data_), size_); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+}  // namespace
+
+std::vector<std::vector<double>> hrm::parse2DBinaryFile(
+    const std::string& filename) {
+    const MappedFile file(filename);
+    const auto invalid = [&filename]() {
+        return std::invalid_argument("Invalid binary file " + filename);
+    };
+
+    // Header
+    std::uint64_t numRow = 0;
+    if (file.size() < sizeof(MAGIC) + sizeof(numRow)) {
+        throw invalid();
+    }
+    std::memcpy(&numRow, file.data() + sizeof(MAGIC), sizeof(numRow));
+
+    size_t offset = sizeof(MAGIC) + sizeof(numRow);
+    std::vector<std::uint64_t> numCol;
+    if (std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) == 0) {
+        if (numRow > (file.size() - offset) / sizeof(std::uint64_t)) {
+            throw invalid();
+        }
+        numCol.resize(numRow);
+        std::memcpy(numCol.data(), file.data() + offset,
+                    numRow * sizeof(std::uint64_t));
+        offset += numRow * sizeof(std::uint64_t);
+    } else if (std::memcmp(file.data(), MAGIC_MATRIX, sizeof(MAGIC)) == 0 &&
+               file.size() >= offset + 2 * sizeof(std::uint64_t)) {
+        // Dense matrix of doubles or 32-bit indices
+        std::uint64_t header[2] = {0, 0};
+        std::memcpy(header, file.data() + offset, sizeof(header));
+        offset += sizeof(header);
+
+        const std::uint64_t numColMatrix = header[0];
+        const size_t entrySize =
+            header[1] == 0 ? sizeof(double) : sizeof(std::uint32_t);
+        if (header[1] > 1 ||
+            (numColMatrix > 0 &&
+             numRow > (file.size() - offset) / entrySize / numColMatrix)) {
+            throw invalid();
+        }
+
+        std::vector<std::vector<double>> data(
+            numRow, std::vector<double>(numColMatrix));
+        for (auto& row : data) {
+            for (auto& entry : row) {
+                if (header[1] == 0) {
+                    std::memcpy(&entry, file.data() + offset, sizeof(double));
+                } else {
+                    std::uint32_t index = 0;
+                    std::memcpy(&index, file.data() + offset, sizeof(index));
+                    entry = static_cast<double>(index);
+                }
+                offset += entrySize;
+            }
+        }
+
+        return data;
+    } else {
+        throw invalid();
+    }
+
+    // Entries, copied row by row from the mapped pages
+    std::vector<std::vector<double>> data(numRow);
+    for (size_t i = 0; i < numRow; ++i) {
+        if (numCol[i] > (file.size() - offset) / sizeof(double)) {
+            throw invalid();
+        }
+        data[i].resize(numCol[i]);
+        std::memcpy(data[i].data(), file.data() + offset,
+                    numCol[i] * sizeof(double));
+        offset += numCol[i] * sizeof(double);
+    }
+
+    return data;
+}
+
+void hrm::write2DBinaryFile(const std::vector<std::vector<double>>& data,
+                            const std::string& filename) {
+    std::vector<std::uint64_t> header = {data.size()};
+    for (const auto& row : data) {
+        header.push_back(row.size());
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    file.write(MAGIC, sizeof(MAGIC));
+    file.write(reinterpret_cast<const char*>(header.data()),
+               header.size() * sizeof(std::uint64_t));
+    for (const auto& row : data) {
+        file.write(reinterpret_cast<const char*>(row.data()),
+                   row.size() * sizeof(double));
+    }
+
+    if (!file) {
+        throw std::invalid_argument("Could not write file " + filename);
+    }
+}
+
+std::string hrm::getBinaryFilename(const std::string& filename) {
+    return std::filesystem::path(filename).replace_extension(".bin").string();
+}
+
+void hrm::convertCsvToBinary(const std::string& filename) {
+    write2DBinaryFile(parse2DCsvFile(filename), getBinaryFilename(filename));
+}
+
+std::vector<std::vector<double>> hrm::parse2DDataFile(
+    const std::string& filename) {
+    namespace fs = std::filesystem;
+
+    if (fs::path(filename).extension() == ".bin") {
+        return parse2DBinaryFile(filename);
+    }
+
+    // Binary file is used only if it is up to date with the .csv file
+    const std::string binaryFilename = getBinaryFilename(filename);
+    std::error_code error;
+    const auto timeBinary = fs::last_write_time(binaryFilename, error);
+    if (!error) {
+        const auto timeCsv = fs::last_write_time(filename, error);
+        if (error || timeBinary >= timeCsv) {
+            return parse2DBinaryFile(binaryFilename);
+        }
+    }
+
+    return parse2DCsvFile(filename);
+}
@@ -1,42 +1,69 @@
 #include "hrm/util/Parse2dCsvFile.h"
 
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+
 std::vector<std::vector<double>> hrm::parse2DCsvFile(
     const std::string& filename) {
+    std::ifstream inputFile(filename, std::ios::binary);
+    if (!inputFile) {
+        std::cerr << "Could not read file " << filename << "\n";
+        std::__throw_invalid_argument("File not found.");
+    }
+
+    // Read the whole file at once and parse in place
+    const std::string content((std::istreambuf_iterator<char>(inputFile)),
+                              std::istreambuf_iterator<char>());
+    const char* ptr = content.data();
+    const char* end = ptr + content.size();
+
     std::vector<std::vector<double>> data;
-    std::ifstream inputFile(filename);
     int l = 0;
-
-    while (inputFile) {
+    while (ptr < end) {
         l++;
-        std::string s;
-        if (!getline(inputFile, s)) {
-            break;
+        const char* lineEnd = std::find(ptr, end, '\n');
+        const char* lineBegin = ptr;
+        ptr = lineEnd + (lineEnd < end ? 1 : 0);
+
+        // Strip carriage return of Windows line endings
+        while (lineEnd > lineBegin &&
+               (lineEnd[-1] == '\r' || lineEnd[-1] == ' ')) {
+            lineEnd--;
+        }
+        if (lineBegin == lineEnd || lineBegin[0] == '#') {
+            continue;
         }
-        if (s[0] != '#') {
-            std::istringstream ss(s);
-            std::vector<double> record;
-
-            while (ss) {
-                std::string line;
-                if (!getline(ss, line, ',')) {
-                    break;
-                }
-                try {
-                    record.emplace_back(stof(line));
-                } catch (const std::invalid_argument& e) {
-                    std::cout << "NaN found in file " << filename << " line "
-                              << l << std::endl;
-                    e.what();
-                }
+
+        std::vector<double> record;
+        const char* field = lineBegin;
+        while (field <= lineEnd) {
+            const char* fieldEnd = std::find(field, lineEnd, ',');
+
+            const char* first = field;
+            while (first < fieldEnd && (*first == ' ' || *first == '\t' ||
+                                        *first == '+')) {
+                first++;
             }
 
-            data.push_back(record);
+            // Empty field after a trailing comma
+            if (first == lineEnd) {
+                break;
+            }
+
+            double value = 0.0;
+            const auto result = std::from_chars(first, fieldEnd, value);
+            if (result.ec == std::errc()) {
+                record.push_back(value);
+            } else {
+                std::cout << "NaN found in file " << filename << " line " << l
+                          << std::endl;
+            }
+
+            field = fieldEnd + 1;
         }
-    }
 
-    if (!inputFile.eof()) {
-        std::cerr << "Could not read file " << filename << "\n";
-        std::__throw_invalid_argument("File not found.");
+        data.push_back(record);
     }
 
     return data;
@@ -13,8 +13,8 @@ hrm::ParseURDF::ParseURDF(const std::string& urdfFile) {
     }
 }
 
-hrm::SE3Transform hrm::ParseURDF::getTransform(const KDL::JntArray& jointConfig,
-                                               const std::string& bodyName) {
+hrm::SE3Transform hrm::ParseURDF::getTransform(
+    const KDL::JntArray& jointConfig, const std::string& bodyName) const {
     hrm::SE3Transform transform = Eigen::Matrix4d::Identity();
     KDL::Frame frame;
 
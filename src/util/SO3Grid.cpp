@@ -0,0 +1,59 @@
+/** \author Sipu Ruan */
+
+#include "hrm/util/SO3Grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+std::vector<Eigen::Quaterniond> hrm::generateSO3Grid(const Index num) {
+    // Irrational steps of the two angles, sqrt(2) and the real root of
+    // x^4 = x + 4, as in the super-Fibonacci spiral
+    const double phi = std::sqrt(2.0);
+    const double psi = 1.533751168755204288118041;
+
+    std::vector<Eigen::Quaterniond> quat;
+    quat.reserve(num);
+    for (size_t i = 0; i < num; ++i) {
+        const double s = static_cast<double>(i) + 0.5;
+        const double t = s / static_cast<double>(num);
+        const double r = std::sqrt(t);
+        const double R = std::sqrt(1.0 - t);
+        const double alpha = 2.0 * PI * s / phi;
+        const double beta = 2.0 * PI * s / psi;
+
+        quat.emplace_back(R * std::cos(beta), r * std::sin(alpha),
+                          r * std::cos(alpha), R * std::sin(beta));
+    }
+
+    return quat;
+}
+
+std::vector<std::vector<hrm::Index>> hrm::getSO3NearestNeighbors(
+    const std::vector<Eigen::Quaterniond>& quat, const Index k) {
+    const Index numNeighbor =
+        std::min(k, quat.empty() ? Index(0) : quat.size() - 1);
+
+    // Angular distance is monotonic in the absolute value of the inner
+    // product, which is compared directly
+    std::vector<std::vector<Index>> neighbors(quat.size());
+    std::vector<double> similarity(quat.size());
+    std::vector<Index> order(quat.size());
+    for (size_t i = 0; i < quat.size(); ++i) {
+        for (size_t j = 0; j < quat.size(); ++j) {
+            similarity[j] = std::fabs(quat[i].dot(quat[j]));
+        }
+        similarity[i] = -1.0;
+
+        std::iota(order.begin(), order.end(), 0);
+        std::partial_sort(order.begin(), order.begin() + numNeighbor,
+                          order.end(), [&similarity](const Index a,
+                                                     const Index b) {
+                              return similarity[a] > similarity[b] ||
+                                     (similarity[a] == similarity[b] && a < b);
+                          });
+        neighbors[i].assign(order.begin(), order.begin() + numNeighbor);
+    }
+
+    return neighbors;
+}
@@ -0,0 +1,124 @@
+/** \author Sipu Ruan */
+
+#include "hrm/config.h"
+#include "hrm/util/DataFileWriter.h"
+#include "hrm/util/Parse2dBinaryFile.h"
+#include "hrm/util/Parse2dCsvFile.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+TEST(TestDataFile, CsvInDoublePrecision) {
+    const std::string filename = CONFIG_PATH "/test_data_file.csv";
+    std::ofstream file(filename);
+    file << "# comment line\r\n"
+         << "0.1234567890123, -2.5,+3e-2\r\n"
+         << "\n"
+         << "1,2\n"
+         << "3,4,\r\n";
+    file.close();
+
+    const auto data = hrm::parse2DCsvFile(filename);
+    ASSERT_EQ(data.size(), 3);
+    ASSERT_EQ(data.at(0).size(), 3);
+    EXPECT_EQ(data.at(0).at(0), 0.1234567890123);
+    EXPECT_EQ(data.at(0).at(1), -2.5);
+    EXPECT_EQ(data.at(0).at(2), 3e-2);
+    EXPECT_EQ(data.at(1), std::vector<double>({1.0, 2.0}));
+    EXPECT_EQ(data.at(2), std::vector<double>({3.0, 4.0}));
+
+    EXPECT_THROW(hrm::parse2DCsvFile(CONFIG_PATH "/not_exist.csv"),
+                 std::invalid_argument);
+    std::filesystem::remove(filename);
+}
+
+TEST(TestDataFile, BinaryConversion) {
+    const std::string filename = CONFIG_PATH "/test_data_file.csv";
+    const std::string binaryFilename = hrm::getBinaryFilename(filename);
+    EXPECT_EQ(binaryFilename, CONFIG_PATH "/test_data_file.bin");
+
+    std::ofstream file(filename);
+    file.precision(17);
+    file << 1.0 / 3.0 << ",2,3,4\n5,6\n";
+    file.close();
+
+    // Same rows from both formats
+    hrm::convertCsvToBinary(filename);
+    const auto data = hrm::parse2DBinaryFile(binaryFilename);
+    EXPECT_EQ(data, hrm::parse2DCsvFile(filename));
+    EXPECT_EQ(data.at(0).at(0), 1.0 / 3.0);
+    EXPECT_EQ(hrm::parse2DDataFile(filename), data);
+
+    // Binary file is preferred when up to date
+    const std::vector<std::vector<double>> binaryData = {{7.0}, {}, {8.0, 9.0}};
+    hrm::write2DBinaryFile(binaryData, binaryFilename);
+    EXPECT_EQ(hrm::parse2DDataFile(filename), binaryData);
+    EXPECT_EQ(hrm::parse2DDataFile(binaryFilename), binaryData);
+
+    // Outdated binary file is ignored
+    std::filesystem::last_write_time(
+        binaryFilename, std::filesystem::last_write_time(filename) -
+                            std::chrono::seconds(10));
+    EXPECT_EQ(hrm::parse2DDataFile(filename), data);
+
+    // Invalid binary file
+    std::ofstream(binaryFilename) << "1,2,3\n";
+    EXPECT_THROW(hrm::parse2DBinaryFile(binaryFilename),
+                 std::invalid_argument);
+
+    std::filesystem::remove(filename);
+    std::filesystem::remove(binaryFilename);
+}
+
+TEST(TestDataFile, StreamingWriter) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> value(-1e3, 1e3);
+    std::vector<std::vector<double>> data(500, std::vector<double>(7));
+    for (auto& row : data) {
+        for (auto& entry : row) {
+            entry = value(generator);
+        }
+    }
+
+    // Small buffer to flush many times, values are restored exactly
+    for (const auto format :
+         {hrm::DataFileFormat::CSV, hrm::DataFileFormat::BINARY}) {
+        const std::string filename = CONFIG_PATH "/test_data_file" +
+                                     hrm::getDataFileExtension(format);
+
+        hrm::DataFileWriter writer(filename, format, 100);
+        for (const auto& row : data) {
+            writer.writeRow(row);
+        }
+        EXPECT_EQ(writer.getNumRow(), data.size());
+        writer.close();
+
+        const auto dataRead = format == hrm::DataFileFormat::BINARY
+                                  ? hrm::parse2DBinaryFile(filename)
+                                  : hrm::parse2DCsvFile(filename);
+        EXPECT_EQ(dataRead, data);
+        std::filesystem::remove(filename);
+    }
+
+    // Binary matrix of indices, rows must have the same size and type
+    const std::string filename = CONFIG_PATH "/test_data_file.bin";
+    hrm::DataFileWriter writer(filename, hrm::DataFileFormat::BINARY);
+    const std::uint32_t edge[2] = {3, 4000000000};
+    writer.writeRow(edge, 2);
+    EXPECT_THROW(writer.writeRow(edge, 1), std::invalid_argument);
+    EXPECT_THROW(writer.writeRow({1.0, 2.0}), std::invalid_argument);
+    writer.close();
+    EXPECT_EQ(hrm::parse2DBinaryFile(filename),
+              std::vector<std::vector<double>>({{3.0, 4e9}}));
+    EXPECT_EQ(std::filesystem::file_size(filename), 32 + 2 * 4);
+    std::filesystem::remove(filename);
+}
+
+int main(int ac, char* av[]) {
+    testing::InitGoogleTest(&ac, av);
+    return RUN_ALL_TESTS();
+}
@@ -1,12 +1,21 @@
 /** \author Sipu Ruan */
 
+#include "hrm/geometry/LineIntersection.h"
 #include "hrm/geometry/SuperEllipse.h"
 #include "hrm/geometry/SuperQuadrics.h"
 #include "hrm/geometry/TightFitEllipsoid.h"
+#include "hrm/util/DistanceMetric.h"
+#include "hrm/util/EllipsoidSeparation.h"
 #include "hrm/util/ExponentialFunction.h"
+#include "hrm/util/InterpolateSE3.h"
+#include "hrm/util/SO3Grid.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+
 // Tests for SuperEllipse
 TEST(TestSuperEllipse, BoundarySampling) {
     const hrm::SuperEllipse S({5.0, 3.0}, 1.25, {-2.6, 3.2}, 0.0, 50);
@@ -95,6 +104,340 @@ TEST(TestTightFittedEllipsoid, MVCE3D) {
     EXPECT_TRUE(std::fabs(mvce.getSemiAxis().at(2) - semiAxis3) < hrm::EPSILON);
 }
 
+TEST(TestTightFittedEllipsoid, TFE3D) {
+    const std::vector<double> a = {4.0, 2.0, 1.0};
+    const Eigen::Quaterniond quatA(Eigen::AngleAxisd(
+        0.3, Eigen::Vector3d(1.0, 2.0, 3.0).normalized()));
+    const Eigen::Quaterniond quatB(Eigen::AngleAxisd(
+        1.2, Eigen::Vector3d(-1.0, 0.5, 2.0).normalized()));
+    const auto tfe = hrm::getTFE3D(a, quatA, quatB, 10, 20);
+
+    // Quadratic form of ellipsoid, TFE encloses the body at both ends
+    auto getShapeMatrix = [](const std::vector<double>& semiAxis,
+                             const Eigen::Quaterniond& quat) {
+        const Eigen::Matrix3d R = quat.toRotationMatrix();
+        const Eigen::Vector3d diag(std::pow(semiAxis[0], -2.0),
+                                   std::pow(semiAxis[1], -2.0),
+                                   std::pow(semiAxis[2], -2.0));
+        return Eigen::Matrix3d(R * diag.asDiagonal() * R.transpose());
+    };
+    const Eigen::Matrix3d C =
+        getShapeMatrix(tfe.getSemiAxis(), tfe.getQuaternion());
+    for (const auto& quat : {quatA, quatB}) {
+        const Eigen::Matrix3d diff = getShapeMatrix(a, quat) - C;
+        EXPECT_GT(Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d>(diff)
+                      .eigenvalues()
+                      .minCoeff(),
+                  -hrm::EPSILON);
+    }
+
+    // Cached results are the same as the computed ones
+    hrm::TFECache cache;
+    const auto tfeCached = cache.getTFE3D(a, quatA, quatB, 10, 20);
+    cache.getTFE3D(a, quatA, quatB, 10, 20);
+    cache.getTFE3D(a, quatB, quatA, 10, 20);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.getNumHit(), 1);
+    EXPECT_EQ(tfeCached.getSemiAxis(), tfe.getSemiAxis());
+}
+
+TEST(TestTightFittedEllipsoid, TFE2D) {
+    const std::vector<double> a = {4.0, 1.0};
+    const double thetaA = -2.5;
+    const double thetaB = 0.5;
+    const auto tfe = hrm::getTFE2D(a, thetaA, thetaB, 10, 20);
+
+    // Points on the body at the interpolated headings are inside TFE
+    const Eigen::Matrix2d R = Eigen::Rotation2Dd(tfe.getAngle()).matrix();
+    for (size_t i = 0; i < 10; ++i) {
+        const double theta = thetaA + (thetaB - thetaA) * double(i) / 9.0;
+        for (size_t j = 0; j < 36; ++j) {
+            const double t = 2.0 * hrm::PI * double(j) / 36.0;
+            const Eigen::Vector2d p =
+                R.transpose() * Eigen::Rotation2Dd(theta).matrix() *
+                Eigen::Vector2d(a[0] * std::cos(t), a[1] * std::sin(t));
+            EXPECT_LT(std::pow(p(0) / tfe.getSemiAxis().at(0), 2.0) +
+                          std::pow(p(1) / tfe.getSemiAxis().at(1), 2.0),
+                      1.0 + 1e-3);
+        }
+    }
+
+    hrm::TFECache cache;
+    cache.getTFE2D(a, thetaA, thetaB, 10, 20);
+    const auto tfeCached = cache.getTFE2D(a, thetaA, thetaB, 10, 20);
+    EXPECT_EQ(cache.getNumHit(), 1);
+    EXPECT_DOUBLE_EQ(tfeCached.getAngle(), tfe.getAngle());
+}
+
+TEST(TestMeshGenerator, ParamSurfaceMesh) {
+    const hrm::Index n = 20;
+    const hrm::SuperQuadrics S1({5.0, 3.0, 2.0}, {1.25, 0.3}, {0.0, 0.0, 0.0},
+                                Eigen::Quaterniond::Identity(), n);
+    const hrm::SuperQuadrics S2({1.0, 2.0, 3.0}, {0.5, 1.0}, {1.0, 2.0, 3.0},
+                                Eigen::Quaterniond::Identity(), n);
+
+    const auto mesh1 = hrm::getMeshFromParamSurface(S1.getOriginShape(), n);
+    const auto mesh2 = hrm::getMeshFromParamSurface(S2.getOriginShape(), n);
+
+    // Faces with the same resolution are shared
+    EXPECT_EQ(mesh1.faces, mesh2.faces);
+    EXPECT_EQ(mesh1.faces->rows(), static_cast<int>(2 * (n - 1) * (n - 1)));
+    EXPECT_EQ(mesh1.faces->minCoeff(), 0);
+    EXPECT_LT(mesh1.faces->maxCoeff(), mesh1.vertices.cols());
+
+    // Vertical line through the center intersects the surface twice
+    hrm::Line3D lineZ(6);
+    lineZ << 0.1, 0.1, 0.0, 0.0, 0.0, 1.0;
+    const auto intersectPoints = hrm::intersectVerticalLineMesh3D(lineZ, mesh1);
+    ASSERT_EQ(intersectPoints.size(), 2);
+    EXPECT_LT(intersectPoints[0][2] * intersectPoints[1][2], 0.0);
+}
+
+TEST(TestLineIntersection, ScanlinePolygons2D) {
+    std::vector<hrm::BoundaryPoints> shapes;
+    for (size_t i = 0; i < 30; ++i) {
+        const hrm::SuperEllipse S(
+            {1.0 + 0.2 * i, 3.0 - 0.05 * i}, 0.2 + 0.05 * i,
+            {-30.0 + 2.0 * i, std::sin(i) * 20.0}, 0.3 * i, 40);
+        shapes.push_back(S.getOriginShape());
+    }
+
+    // Lines in descending order, including the ones through vertices
+    std::vector<double> ty = {shapes[0](1, 3), shapes[5](1, 0)};
+    for (size_t i = 0; i < 500; ++i) {
+        ty.push_back(30.0 - 0.12 * i);
+    }
+
+    std::vector<std::vector<double>> low(
+        ty.size(), std::vector<double>(shapes.size()));
+    std::vector<std::vector<double>> upp = low;
+    hrm::intersectHorizontalLinesPolygons2D(ty, shapes, low, upp);
+
+    for (size_t i = 0; i < ty.size(); ++i) {
+        for (size_t j = 0; j < shapes.size(); ++j) {
+            const auto points =
+                hrm::intersectHorizontalLinePolygon2D(ty[i], shapes[j]);
+            if (points.empty()) {
+                EXPECT_TRUE(std::isnan(low[i][j]));
+                EXPECT_TRUE(std::isnan(upp[i][j]));
+            } else {
+                EXPECT_DOUBLE_EQ(low[i][j], std::fmin(points[0], points[1]));
+                EXPECT_DOUBLE_EQ(upp[i][j], std::fmax(points[0], points[1]));
+            }
+        }
+    }
+}
+
+TEST(TestLineIntersection, SegmentPolygon2D) {
+    const hrm::SuperEllipse S({5.0, 3.0}, 1.5, {1.0, -2.0}, 0.6, 50);
+    const hrm::BoundaryPoints shape = S.getOriginShape();
+    const auto box = hrm::getBoundingBox2D(shape);
+
+    // Parametric solution at each edge as reference
+    auto isIntersectReference = [&shape](const Eigen::Vector2d& p1,
+                                         const Eigen::Vector2d& p2) {
+        for (auto i = 0; i < shape.cols(); ++i) {
+            const auto j = (i == shape.cols() - 1) ? 0 : i + 1;
+            Eigen::Matrix2d A;
+            A.col(0) = p2 - p1;
+            A.col(1) = shape.col(i) - shape.col(j);
+            const Eigen::Vector2d sol =
+                A.colPivHouseholderQr().solve(shape.col(i) - p1);
+            if (sol(0) > 0.0 && sol(0) < 1.0 && sol(1) > 0.0 &&
+                sol(1) < 1.0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::srand(1);
+    hrm::Index numIntersect = 0;
+    for (size_t i = 0; i < 2000; ++i) {
+        const Eigen::Vector2d p1 = 10.0 * Eigen::Vector2d::Random();
+        const Eigen::Vector2d p2 = 10.0 * Eigen::Vector2d::Random();
+        const auto seg = std::make_pair(std::vector<double>{p1(0), p1(1)},
+                                        std::vector<double>{p2(0), p2(1)});
+
+        const bool isIntersect = hrm::isIntersectSegPolygon2D(seg, shape);
+        EXPECT_EQ(isIntersect, isIntersectReference(p1, p2));
+        if (isIntersect) {
+            EXPECT_TRUE(hrm::isIntersectSegBox2D(seg, box));
+            numIntersect++;
+        }
+    }
+    EXPECT_GT(numIntersect, 0);
+
+    // Segment beside the box, although their bounding boxes overlap
+    const auto corner = box.corner(Eigen::AlignedBox2d::TopRight);
+    const auto seg = std::make_pair(
+        std::vector<double>{corner(0) - 1.0, corner(1) + 2.0},
+        std::vector<double>{corner(0) + 2.0, corner(1) - 1.0});
+    EXPECT_FALSE(hrm::isIntersectSegBox2D(seg, box));
+}
+
+TEST(TestMeshGenerator, SuperQuadricsMesh) {
+    const hrm::Index n = 20;
+    const hrm::SuperQuadrics S({5.0, 3.0, 2.0}, {1.0, 1.0}, {1.0, 2.0, 3.0},
+                               Eigen::Quaterniond(0.0, 1.0, 0.0, 0.0), n);
+    const auto mesh = hrm::getMeshFromSQ(S);
+    ASSERT_EQ(mesh.vertices.size(), (n - 2) * n + 2);
+    ASSERT_EQ(mesh.triangles.size(), 2 * n * (n - 2));
+
+    // Closed surface: each edge is shared by two triangles in opposite
+    // directions
+    std::map<std::pair<size_t, size_t>, int> edgeCount;
+    double volume = 0.0;
+    for (const auto& triangle : mesh.triangles) {
+        for (size_t i = 0; i < 3; ++i) {
+            edgeCount[{triangle[i], triangle[(i + 1) % 3]}]++;
+        }
+        volume += mesh.vertices.at(triangle[0])
+                      .dot(mesh.vertices.at(triangle[1])
+                               .cross(mesh.vertices.at(triangle[2]))) /
+                  6.0;
+    }
+    for (const auto& edge : edgeCount) {
+        EXPECT_EQ(edge.second, 1);
+        EXPECT_EQ(edgeCount.count({edge.first.second, edge.first.first}), 1);
+    }
+
+    // Vertices on the surface at origin, and the inscribed polyhedron has
+    // outward normals
+    for (const auto& vertex : mesh.vertices) {
+        EXPECT_NEAR(std::pow(vertex(0) / 5.0, 2.0) +
+                        std::pow(vertex(1) / 3.0, 2.0) +
+                        std::pow(vertex(2) / 2.0, 2.0),
+                    1.0, 1e-6);
+    }
+    const double volumeEllipsoid = 4.0 / 3.0 * hrm::PI * 5.0 * 3.0 * 2.0;
+    EXPECT_GT(volume, 0.95 * volumeEllipsoid);
+    EXPECT_LT(volume, volumeEllipsoid);
+}
+
+TEST(TestEllipsoidSeparation, BatchSeparation) {
+    std::srand(1);
+    auto sampleEllipsoid = []() {
+        const Eigen::Vector3d semiAxis =
+            1.5 * Eigen::Vector3d::Random().cwiseAbs() +
+            Eigen::Vector3d::Constant(0.2);
+        const Eigen::Vector3d position = 4.0 * Eigen::Vector3d::Random();
+
+        return hrm::SuperQuadrics({semiAxis(0), semiAxis(1), semiAxis(2)},
+                                  {1.0, 1.0},
+                                  {position(0), position(1), position(2)},
+                                  Eigen::Quaterniond::UnitRandom(), 10);
+    };
+
+    std::vector<hrm::SuperQuadrics> obstacles;
+    for (int i = 0; i < 50; ++i) {
+        obstacles.push_back(sampleEllipsoid());
+    }
+    const auto batch = hrm::getEllipsoidBatch(obstacles);
+    ASSERT_EQ(batch.size(), obstacles.size());
+
+    // Batched test agrees with pairwise test
+    int numSeparated = 0;
+    for (int i = 0; i < 100; ++i) {
+        const auto robot = sampleEllipsoid();
+
+        bool isSeparatedAll = true;
+        for (const auto& obstacle : obstacles) {
+            const bool isSeparated = hrm::isEllipsoidSeparated(robot, obstacle);
+            EXPECT_EQ(hrm::isEllipsoidSeparated(
+                          robot, hrm::getEllipsoidBatch({obstacle})),
+                      isSeparated);
+
+            isSeparatedAll = isSeparatedAll && isSeparated;
+            numSeparated += isSeparated ? 1 : 0;
+        }
+
+        EXPECT_EQ(hrm::isEllipsoidSeparated(robot, batch), isSeparatedAll);
+    }
+
+    // Both separated and overlapping pairs are sampled
+    EXPECT_GT(numSeparated, 0);
+    EXPECT_LT(numSeparated, 100 * 50);
+}
+
+// Tests for fixed-size configuration types
+TEST(TestConfiguration, InterpolateCompoundSE3Rn) {
+    const Eigen::Quaterniond quatStart(0.5, 0.5, 0.5, 0.5);
+    const Eigen::Quaterniond quatEnd(0.0, 1.0, 0.0, 0.0);
+    const std::vector<double> vStart{
+        1.0,           -2.0,          0.5, quatStart.w(), quatStart.x(),
+        quatStart.y(), quatStart.z(), 0.3, -0.6};
+    const std::vector<double> vEnd{
+        -3.0,        4.0,         2.5,  quatEnd.w(), quatEnd.x(),
+        quatEnd.y(), quatEnd.z(), -1.2, 0.9};
+    const hrm::Index numStep = 10;
+
+    const auto vInterp = hrm::interpolateCompoundSE3Rn(vStart, vEnd, numStep);
+
+    hrm::ConfigurationList<hrm::ConfigurationSE3Rn<2>::RowsAtCompileTime>
+        vInterpFixed;
+    hrm::interpolateCompoundSE3Rn(hrm::toConfiguration<9>(vStart),
+                                  hrm::toConfiguration<9>(vEnd), numStep,
+                                  vInterpFixed);
+
+    ASSERT_EQ(vInterp.size(), vInterpFixed.size());
+    for (size_t i = 0; i < vInterp.size(); ++i) {
+        EXPECT_TRUE(hrm::vectorEuclidean(vInterp.at(i),
+                                         hrm::toVector(vInterpFixed.at(i))) <
+                    hrm::EPSILON);
+    }
+
+    EXPECT_DOUBLE_EQ(hrm::configurationEuclidean(vInterpFixed.front(),
+                                                 vInterpFixed.back()),
+                     hrm::vectorEuclidean(vStart, vEnd));
+}
+
+TEST(TestSO3Grid, UniformGrid) {
+    const hrm::Index num = 500;
+    const auto grid = hrm::generateSO3Grid(num);
+    ASSERT_EQ(grid.size(), num);
+    EXPECT_TRUE(grid.at(7).isApprox(hrm::generateSO3Grid(num).at(7)));
+
+    // Covering radius is below the one of uniform random samples of the same
+    // size, which is about 0.65
+    std::srand(1);
+    double maxDist = 0.0;
+    for (size_t i = 0; i < 1000; ++i) {
+        const auto query = Eigen::Quaterniond::UnitRandom();
+        double minDist = INFINITY;
+        for (const auto& q : grid) {
+            EXPECT_NEAR(q.norm(), 1.0, hrm::EPSILON);
+            minDist = std::fmin(minDist, query.angularDistance(q));
+        }
+        maxDist = std::fmax(maxDist, minDist);
+    }
+    EXPECT_LT(maxDist, 0.6);
+}
+
+TEST(TestSO3Grid, NearestNeighbors) {
+    const auto grid = hrm::generateSO3Grid(100);
+    const hrm::Index k = 5;
+    const auto neighbors = hrm::getSO3NearestNeighbors(grid, k);
+    ASSERT_EQ(neighbors.size(), grid.size());
+
+    for (size_t i = 0; i < grid.size(); ++i) {
+        ASSERT_EQ(neighbors.at(i).size(), k);
+
+        // The k-th neighbor is no farther than any other orientation
+        const double kthDist =
+            grid.at(i).angularDistance(grid.at(neighbors.at(i).back()));
+        for (size_t j = 0; j < grid.size(); ++j) {
+            if (j == i || std::find(neighbors.at(i).begin(),
+                                    neighbors.at(i).end(),
+                                    j) != neighbors.at(i).end()) {
+                continue;
+            }
+            EXPECT_GE(grid.at(i).angularDistance(grid.at(j)),
+                      kthDist - hrm::EPSILON);
+        }
+    }
+}
+
 int main(int ac, char* av[]) {
     testing::InitGoogleTest(&ac, av);
     return RUN_ALL_TESTS();
@@ -9,6 +9,69 @@
 
 #include "gtest/gtest.h"
 
+#include <set>
+
+/** \brief Whether boundary points of one shape are inside another shape
+ * \param pts Boundary points
+ * \param shape Superellipse, shrunk slightly for the discrete boundaries
+ * \return true if any point is inside, false otherwise */
+bool isAnyPointInside(const hrm::BoundaryPoints& pts,
+                      const hrm::SuperEllipse& shape) {
+    const Eigen::Matrix2d rot = Eigen::Rotation2Dd(-shape.getAngle()).matrix();
+    const Eigen::Vector2d center(shape.getPosition().at(0),
+                                 shape.getPosition().at(1));
+    for (auto i = 0; i < pts.cols(); ++i) {
+        const Eigen::Vector2d p = rot * (pts.col(i) - center);
+        const double value =
+            std::pow(std::fabs(p(0)) / shape.getSemiAxis().at(0),
+                     2.0 / shape.getEpsilon()) +
+            std::pow(std::fabs(p(1)) / shape.getSemiAxis().at(1),
+                     2.0 / shape.getEpsilon());
+        if (value < 1.0 - 1e-2) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** \brief Check a straight motion densely against the obstacles
+ * \param robot Multi-body robot
+ * \param obs Obstacles
+ * \param v1, v2 End configurations
+ * \param numStep Number of interpolation steps
+ * \return true if all the interpolated poses are collision-free */
+bool isMotionFree(const hrm::MultiBodyTree2D& robot,
+                  const std::vector<hrm::SuperEllipse>& obs,
+                  const std::vector<hrm::Coordinate>& v1,
+                  const std::vector<hrm::Coordinate>& v2,
+                  const hrm::Index numStep) {
+    for (size_t k = 0; k <= numStep; ++k) {
+        const double t = static_cast<double>(k) / static_cast<double>(numStep);
+        hrm::SE2Transform g = hrm::SE2Transform::Identity();
+        g.topLeftCorner(2, 2) =
+            Eigen::Rotation2Dd(v1[2] + t * (v2[2] - v1[2])).toRotationMatrix();
+        g.topRightCorner(2, 1) = hrm::Point2D(v1[0] + t * (v2[0] - v1[0]),
+                                              v1[1] + t * (v2[1] - v1[1]));
+
+        auto robotAux = robot;
+        robotAux.robotTF(g);
+        std::vector<hrm::SuperEllipse> body = robotAux.getLinks();
+        body.push_back(robotAux.getBase());
+
+        for (const auto& b : body) {
+            for (const auto& o : obs) {
+                if (isAnyPointInside(b.getOriginShape(), o) ||
+                    isAnyPointInside(o.getOriginShape(), b)) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 template <class algorithm, class robotType>
 algorithm planTest(const robotType& robot,
                    const std::vector<hrm::SuperEllipse>& arena,
@@ -161,6 +224,74 @@ TEST(TestHRMPlanning2D, KinematicsOfContainment) {
     hrm::evaluateResult(res);
 }
 
+TEST(TestHRMPlanning2D, ShortcutPath) {
+    std::cout << "Highway RoadMap for 2D planning" << std::endl;
+    std::cout << "Post-processing: Path shortcutting" << std::endl;
+    std::cout << "----------" << std::endl;
+
+    // Load Robot and Environment settings
+    hrm::parsePlanningConfig("superellipse", "sparse", "rabbit", "2D");
+    const int NUM_CURVE_PARAM = 50;
+
+    const auto robot =
+        hrm::loadRobotMultiBody2D(CONFIG_PATH "/", NUM_CURVE_PARAM);
+    hrm::PlannerSetting2D env2D(NUM_CURVE_PARAM);
+    env2D.loadEnvironment(CONFIG_PATH "/");
+
+    // Planning requests
+    hrm::PlanningRequest req;
+    req.start = env2D.getEndPoints().at(0);
+    req.goal = env2D.getEndPoints().at(1);
+
+    req.parameters.numSlice = 10;
+    req.parameters.numPoint = 5;
+    req.parameters.numThread = 4;
+    hrm::defineParameters(robot, env2D, req.parameters);
+
+    // Plan with and without shortcutting
+    auto hrm = planTest<hrm::planners::HRM2D, hrm::MultiBodyTree2D>(
+        robot, env2D.getArena(), env2D.getObstacle(), req, false);
+
+    req.parameters.isShortcutPath = true;
+    auto hrmShortcut = planTest<hrm::planners::HRM2D, hrm::MultiBodyTree2D>(
+        robot, env2D.getArena(), env2D.getObstacle(), req, false);
+    const hrm::PlanningResult& res = hrmShortcut.getPlanningResult();
+
+    // Test result
+    hrm::evaluateResult(res);
+
+    // Shortcut path keeps the end points, and is not longer than the
+    // original one
+    const auto& path = hrm.getPlanningResult().solutionPath.solvedPath;
+    const auto& pathShortcut = res.solutionPath.solvedPath;
+    ASSERT_LE(pathShortcut.size(), path.size());
+    EXPECT_EQ(pathShortcut.front(), path.front());
+    EXPECT_EQ(pathShortcut.back(), path.back());
+
+    double length = 0.0;
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        length += hrm::vectorEuclidean(path.at(i), path.at(i + 1));
+    }
+    EXPECT_LE(res.solutionPath.cost, length + hrm::EPSILON);
+    EXPECT_GT(res.planningTime.shortcutTime, 0.0);
+
+    // New connections from shortcutting are collision-free when checked
+    // densely
+    std::set<std::pair<std::vector<hrm::Coordinate>,
+                       std::vector<hrm::Coordinate>>>
+        edge;
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        edge.emplace(path.at(i), path.at(i + 1));
+    }
+    for (size_t i = 0; i + 1 < pathShortcut.size(); ++i) {
+        if (edge.count({pathShortcut.at(i), pathShortcut.at(i + 1)}) == 0) {
+            EXPECT_TRUE(isMotionFree(robot, env2D.getObstacle(),
+                                     pathShortcut.at(i),
+                                     pathShortcut.at(i + 1), 100));
+        }
+    }
+}
+
 int main(int ac, char* av[]) {
     testing::InitGoogleTest(&ac, av);
     return RUN_ALL_TESTS();
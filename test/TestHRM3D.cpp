@@ -5,7 +5,7 @@
 #include "hrm/test/util/GTestUtils.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
-TEST(TestHRMPlanning3D, HRM) {
+void testHRM3D(const bool isStreamingSlice) {
     // Setup environment config
     hrm::parsePlanningConfig("superquadrics", "sparse", "rabbit", "3D");
     const int NUM_SURF_PARAM = 10;
@@ -27,6 +27,7 @@ TEST(TestHRMPlanning3D, HRM) {
     req.start = env3D.getEndPoints().at(0);
     req.goal = env3D.getEndPoints().at(1);
     hrm::defineParameters(robot, env3D, req.parameters);
+    req.parameters.isStreamingSlice = isStreamingSlice;
 
     // Main algorithm
     std::cout << "Highway RoadMap for 3D rigid-body planning" << std::endl;
@@ -51,6 +52,70 @@ TEST(TestHRMPlanning3D, HRM) {
               << hrm.getPlannerParameters().numLineY << '}' << std::endl;
 
     hrm::evaluateResult(res);
+
+    // No C-slice boundary is kept in streaming mode
+    EXPECT_EQ(hrm.getCSpaceBoundary().empty(), isStreamingSlice);
+}
+
+TEST(TestHRMPlanning3D, HRM) { testHRM3D(false); }
+
+TEST(TestHRMPlanning3D, HRMStreamingSlice) { testHRM3D(true); }
+
+TEST(TestHRMPlanning3D, MultiThreadSweepLine) {
+    // Setup environment config
+    hrm::parsePlanningConfig("superquadrics", "sparse", "rabbit", "3D");
+    const int NUM_SURF_PARAM = 10;
+    const double MAX_PLAN_TIME = 60.0;
+
+    hrm::PlannerSetting3D env3D(NUM_SURF_PARAM);
+    env3D.loadEnvironment(CONFIG_PATH "/");
+
+    const std::string quatFile =
+        RESOURCES_PATH "/SO3_sequence/q_icosahedron_60.csv";
+    const auto robot =
+        hrm::loadRobotMultiBody3D(CONFIG_PATH "/", quatFile, NUM_SURF_PARAM);
+
+    hrm::PlanningRequest req;
+    req.start = env3D.getEndPoints().at(0);
+    req.goal = env3D.getEndPoints().at(1);
+    hrm::defineParameters(robot, env3D, req.parameters);
+
+    // Same roadmap and free segments with sequential and parallel sweeps
+    req.parameters.numThread = 1;
+    hrm::planners::HRM3D hrm(robot, env3D.getArena(), env3D.getObstacle(),
+                             req);
+    hrm.plan(MAX_PLAN_TIME);
+    const auto freeSegment =
+        hrm.getFreeSegmentOneSlice(&hrm.getCSpaceBoundary().at(0));
+
+    req.parameters.numThread = 4;
+    hrm::planners::HRM3D hrmParallel(robot, env3D.getArena(),
+                                     env3D.getObstacle(), req);
+    hrmParallel.plan(MAX_PLAN_TIME);
+    const auto freeSegmentParallel = hrmParallel.getFreeSegmentOneSlice(
+        &hrmParallel.getCSpaceBoundary().at(0));
+
+    ASSERT_EQ(freeSegment.tx, freeSegmentParallel.tx);
+    ASSERT_EQ(freeSegment.freeSegmentYZ.size(),
+              freeSegmentParallel.freeSegmentYZ.size());
+    for (size_t i = 0; i < freeSegment.freeSegmentYZ.size(); ++i) {
+        const auto& seg = freeSegment.freeSegmentYZ.at(i);
+        const auto& segParallel = freeSegmentParallel.freeSegmentYZ.at(i);
+        EXPECT_EQ(seg.ty, segParallel.ty);
+        EXPECT_EQ(seg.xL, segParallel.xL);
+        EXPECT_EQ(seg.xU, segParallel.xU);
+        EXPECT_EQ(seg.xM, segParallel.xM);
+    }
+
+    const auto& graph = hrm.getPlanningResult().graphStructure;
+    const auto& graphParallel =
+        hrmParallel.getPlanningResult().graphStructure;
+    ASSERT_EQ(graph.vertex.size(), graphParallel.vertex.size());
+    for (size_t i = 0; i < graph.vertex.size(); ++i) {
+        EXPECT_EQ(graph.vertex[i], graphParallel.vertex[i]);
+    }
+    EXPECT_EQ(graph.edge, graphParallel.edge);
+    EXPECT_EQ(graph.weight, graphParallel.weight);
 }
 
 int main(int ac, char* av[]) {
@@ -4,6 +4,24 @@
 #include "hrm/planners/HRM3DAblation.h"
 #include "hrm/test/util/GTestUtils.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
+#include "hrm/util/ObstacleCollisionManager.h"
+
+/** \brief Ablated planner exposing the checks of C-slice transitions */
+class HRM3DAblationTransition
+    : public hrm::planners::HRM3DAblation<hrm::planners::HRM3D> {
+  public:
+    using hrm::planners::HRM3DAblation<hrm::planners::HRM3D>::HRM3DAblation;
+    using hrm::planners::HRM3DAblation<
+        hrm::planners::HRM3D>::isMultiSliceTransitionFree;
+};
+
+/** \brief Pose with identity rotation */
+fcl::Transform3d getTranslation(const double x, const double y,
+                                const double z) {
+    fcl::Transform3d tf = fcl::Transform3d::Identity();
+    tf.translation() << x, y, z;
+    return tf;
+}
 
 TEST(TestHRMPlanning3D, HRMAblation) {
     // Setup environment config
@@ -54,6 +72,63 @@ TEST(TestHRMPlanning3D, HRMAblation) {
     hrm::evaluateResult(res);
 }
 
+TEST(TestHRMPlanning3D, ContinuousCollisionManager) {
+    // Thin plate obstacle at the origin, normal to x-axis
+    std::vector<fcl::CollisionObject<double>> objObs;
+    objObs.emplace_back(std::make_shared<fcl::Boxd>(0.02, 4.0, 4.0),
+                        getTranslation(0.0, 0.0, 0.0));
+
+    hrm::ObstacleCollisionManager obsManager;
+    obsManager.setObstacles(objObs);
+    EXPECT_EQ(obsManager.getNumObstacles(), objObs.size());
+
+    std::shared_ptr<fcl::CollisionGeometry<double>> body =
+        std::make_shared<fcl::Sphered>(0.1);
+    body->computeLocalAABB();
+
+    // Both ends are free, but the motion crosses the plate
+    const fcl::Transform3d tfStart = getTranslation(-1.0, 0.0, 0.0);
+    const fcl::Transform3d tfGoal = getTranslation(1.0, 0.0, 0.0);
+    EXPECT_FALSE(obsManager.isCollision(body, tfStart));
+    EXPECT_FALSE(obsManager.isCollision(body, tfGoal));
+    EXPECT_TRUE(obsManager.isContinuousCollision(body, tfStart, tfGoal));
+
+    // Motion parallel to the plate
+    EXPECT_FALSE(obsManager.isContinuousCollision(
+        body, tfStart, getTranslation(-1.0, 1.0, 0.0)));
+}
+
+TEST(TestHRMPlanning3D, HRMAblationContinuousTransition) {
+    const int NUM_SURF_PARAM = 10;
+    const Eigen::Quaterniond quat = Eigen::Quaterniond::Identity();
+
+    // Spherical robot, thin ellipsoidal obstacle normal to x-axis
+    const hrm::MultiBodyTree3D robot(hrm::SuperQuadrics(
+        {0.1, 0.1, 0.1}, {1.0, 1.0}, {0.0, 0.0, 0.0}, quat, NUM_SURF_PARAM));
+    const std::vector<hrm::SuperQuadrics> arena = {hrm::SuperQuadrics(
+        {5.0, 5.0, 5.0}, {0.1, 0.1}, {0.0, 0.0, 0.0}, quat, NUM_SURF_PARAM)};
+    const std::vector<hrm::SuperQuadrics> obs = {hrm::SuperQuadrics(
+        {0.01, 2.0, 2.0}, {1.0, 1.0}, {0.0, 0.0, 0.0}, quat, NUM_SURF_PARAM)};
+
+    hrm::PlanningRequest req;
+    req.parameters.boundaryLimits = {-5.0, 5.0, -5.0, 5.0, -5.0, 5.0};
+    req.parameters.numLineY = 1;
+
+    // Interpolated poses on both sides of the obstacle are free
+    const std::vector<hrm::Coordinate> v1 = {-1.0, 0.0, 0.0, 1.0,
+                                             0.0,  0.0, 0.0};
+    const std::vector<hrm::Coordinate> v2 = {1.0, 0.0, 0.0, 1.0,
+                                             0.0, 0.0, 0.0};
+
+    req.parameters.isContinuousCollision = false;
+    HRM3DAblationTransition hrmSampled(robot, arena, obs, req);
+    EXPECT_TRUE(hrmSampled.isMultiSliceTransitionFree(v1, v2));
+
+    req.parameters.isContinuousCollision = true;
+    HRM3DAblationTransition hrmContinuous(robot, arena, obs, req);
+    EXPECT_FALSE(hrmContinuous.isMultiSliceTransitionFree(v1, v2));
+}
+
 int main(int ac, char* av[]) {
     testing::InitGoogleTest(&ac, av);
     return RUN_ALL_TESTS();
@@ -0,0 +1,64 @@
+/** \author Sipu Ruan */
+
+#include "hrm/datastructure/IntervalTree.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+TEST(TestIntervalTree, BruteForceComparison) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> position(-100.0, 100.0);
+    std::uniform_real_distribution<double> length(0.0, 20.0);
+
+    const hrm::Index numInterval = 500;
+    std::vector<hrm::Coordinate> low(numInterval);
+    std::vector<hrm::Coordinate> upp(numInterval);
+    for (size_t i = 0; i < numInterval; ++i) {
+        low[i] = position(generator);
+        upp[i] = low[i] + length(generator);
+    }
+
+    // Interval ignored by the tree
+    low[3] = NAN;
+
+    hrm::IntervalTree tree;
+    tree.build(low, upp);
+    EXPECT_EQ(tree.size(), numInterval - 1);
+
+    // Query points include the bounds of intervals
+    std::vector<hrm::Coordinate> points = {low[0], upp[1], -200.0, 200.0};
+    for (size_t i = 0; i < 200; ++i) {
+        points.push_back(position(generator));
+    }
+
+    for (const auto point : points) {
+        std::vector<hrm::Index> result;
+        tree.query(point, result);
+        std::sort(result.begin(), result.end());
+
+        std::vector<hrm::Index> expected;
+        for (size_t i = 0; i < numInterval; ++i) {
+            if (low[i] <= point && upp[i] >= point) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(result, expected);
+    }
+}
+
+TEST(TestIntervalTree, Empty) {
+    hrm::IntervalTree tree;
+    tree.build({}, {});
+
+    std::vector<hrm::Index> result;
+    tree.query(0.0, result);
+    EXPECT_TRUE(result.empty());
+}
+
+int main(int ac, char* av[]) {
+    testing::InitGoogleTest(&ac, av);
+    return RUN_ALL_TESTS();
+}
@@ -7,7 +7,8 @@
 
 namespace ho = hrm::planners::ompl_interface;
 
-void TestOMPLPlanner(const int plannerIdx, const int samplerIdx) {
+void TestOMPLPlanner(const int plannerIdx, const int samplerIdx,
+                     const int motionValidatorIdx = 0) {
     // Read and setup environment config
     hrm::parsePlanningConfig("superquadrics", "sparse", "rabbit", "3D");
     const int NUM_SURF_PARAM = 10;
@@ -45,7 +46,7 @@ void TestOMPLPlanner(const int plannerIdx, const int samplerIdx) {
     std::cout << "----------" << std::endl;
 
     ho::OMPL3D omplPlanner(b1, b2, robot, arena, obs, obsMesh);
-    omplPlanner.setup(plannerIdx, samplerIdx);
+    omplPlanner.setup(plannerIdx, samplerIdx, motionValidatorIdx);
 
     omplPlanner.plan(env3D.getEndPoints().at(0), env3D.getEndPoints().at(1),
                      MAX_PLAN_TIME);
@@ -84,6 +85,8 @@ TEST(OMPLPlanning, SBL) { TestOMPLPlanner(5, 0); }
 
 TEST(OMPLPlanning, KPIECE) { TestOMPLPlanner(6, 0); }
 
+TEST(OMPLPlanning, RRTConnectClearance) { TestOMPLPlanner(3, 0, 1); }
+
 int main(int ac, char* av[]) {
     testing::InitGoogleTest(&ac, av);
     return RUN_ALL_TESTS();
@@ -5,7 +5,7 @@
 #include "hrm/test/util/GTestUtils.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
-TEST(TestHRMPlanning3D, ProbHRM) {
+void testProbHRM(const hrm::Index numThread) {
     // Setup environment config
     hrm::parsePlanningConfig("superquadrics", "sparse", "snake", "3D");
     const int NUM_SURF_PARAM = 10;
@@ -35,6 +35,7 @@ TEST(TestHRMPlanning3D, ProbHRM) {
     req.start = env3D.getEndPoints().at(0);
     req.goal = env3D.getEndPoints().at(1);
     hrm::defineParameters(robot, env3D, req.parameters);
+    req.parameters.numThread = numThread;
 
     // Main Algorithm
     std::cout << "Prob-HRM for 3D articulated-body planning" << std::endl;
@@ -42,6 +43,8 @@ TEST(TestHRMPlanning3D, ProbHRM) {
     std::cout << "Input number of sweep lines {X,Y}: {"
               << req.parameters.numLineX << ',' << req.parameters.numLineY
               << '}' << std::endl;
+    std::cout << "Number of threads: " << req.parameters.numThread
+              << std::endl;
     std::cout << "----------" << std::endl;
 
     std::cout << "Start planning..." << std::endl;
@@ -61,6 +64,10 @@ TEST(TestHRMPlanning3D, ProbHRM) {
     hrm::evaluateResult(res);
 }
 
+TEST(TestHRMPlanning3D, ProbHRM) { testProbHRM(1); }
+
+TEST(TestHRMPlanning3D, ProbHRMParallel) { testProbHRM(4); }
+
 int main(int ac, char* av[]) {
     testing::InitGoogleTest(&ac, av);
     return RUN_ALL_TESTS();
@@ -0,0 +1,161 @@
+/** \author Sipu Ruan */
+
+#include "hrm/planners/RoadmapSearch.h"
+#include "hrm/util/DistanceMetric.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+// Grid roadmap with a wall in the middle, leaving a gap at the top
+hrm::Graph generateGridRoadmap(const hrm::Index size) {
+    hrm::Graph graph;
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            graph.vertex.push_back(
+                {static_cast<double>(i), static_cast<double>(j)});
+        }
+    }
+
+    auto isWall = [size](const hrm::Index i, const hrm::Index j) {
+        return i == size / 2 && j < size - 2;
+    };
+
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            if (isWall(i, j)) {
+                continue;
+            }
+
+            const hrm::Index u = i * size + j;
+            if (i + 1 < size && !isWall(i + 1, j)) {
+                graph.edge.emplace_back(u, u + size);
+                graph.weight.push_back(1.0);
+            }
+            if (j + 1 < size && !isWall(i, j + 1)) {
+                graph.edge.emplace_back(u, u + 1);
+                graph.weight.push_back(1.0);
+            }
+        }
+    }
+
+    return graph;
+}
+
+void checkPath(const hrm::Graph& graph,
+               const hrm::planners::RoadmapSearchResult& res,
+               const hrm::Index source, const hrm::Index target) {
+    ASSERT_TRUE(res.solved);
+    ASSERT_EQ(res.path.front(), source);
+    ASSERT_EQ(res.path.back(), target);
+
+    double cost = 0.0;
+    for (size_t i = 0; i + 1 < res.path.size(); ++i) {
+        const double dist =
+            hrm::vectorEuclidean(graph.vertex.at(res.path.at(i)),
+                                 graph.vertex.at(res.path.at(i + 1)));
+        ASSERT_NEAR(dist, 1.0, hrm::EPSILON);
+        cost += dist;
+    }
+    EXPECT_NEAR(cost, res.cost, hrm::EPSILON);
+}
+
+TEST(TestRoadmapSearch, SearchStrategies) {
+    const hrm::Index size = 20;
+    const hrm::Graph graph = generateGridRoadmap(size);
+    const hrm::Index source = 0;
+    const hrm::Index target = size * size - 1;
+
+    hrm::planners::RoadmapSearch roadmap(graph);
+    roadmap.computeLandmarks(4);
+    ASSERT_EQ(roadmap.getLandmarks().size(), 4);
+
+    // Optimal strategies
+    const auto resAStar = roadmap.search(source, target, 0);
+    checkPath(graph, resAStar, source, target);
+
+    const auto resBidirectional = roadmap.search(source, target, 1);
+    checkPath(graph, resBidirectional, source, target);
+    EXPECT_NEAR(resBidirectional.cost, resAStar.cost, hrm::EPSILON);
+
+    const auto resALT = roadmap.search(source, target, 2);
+    checkPath(graph, resALT, source, target);
+    EXPECT_NEAR(resALT.cost, resAStar.cost, hrm::EPSILON);
+    EXPECT_LE(resALT.numExpansion, resAStar.numExpansion);
+
+    // Bounded-suboptimal strategy
+    const double weight = 2.0;
+    const auto resWeighted = roadmap.search(source, target, 3, weight);
+    checkPath(graph, resWeighted, source, target);
+    EXPECT_LE(resWeighted.cost, weight * resAStar.cost + hrm::EPSILON);
+    EXPECT_LE(resWeighted.numExpansion, resAStar.numExpansion);
+}
+
+TEST(TestRoadmapSearch, DisconnectedRoadmap) {
+    hrm::Graph graph;
+    graph.vertex = {{0.0, 0.0}, {1.0, 0.0}, {5.0, 0.0}, {6.0, 0.0}};
+    graph.edge = {{0, 1}, {2, 3}};
+    graph.weight = {1.0, 1.0};
+
+    hrm::planners::RoadmapSearch roadmap(graph);
+    roadmap.computeLandmarks(2);
+
+    for (hrm::Index strategy = 0; strategy < 4; ++strategy) {
+        EXPECT_FALSE(roadmap.search(0, 3, strategy, 1.5).solved);
+        EXPECT_TRUE(roadmap.search(2, 3, strategy, 1.5).solved);
+    }
+}
+
+TEST(TestRoadmapSearch, IncrementalLandmarks) {
+    const hrm::Index size = 20;
+    hrm::Graph graph = generateGridRoadmap(size);
+
+    hrm::planners::LandmarkTable landmark;
+    {
+        hrm::planners::RoadmapSearch roadmap(graph, landmark);
+        roadmap.updateLandmarks(4);
+    }
+    const std::vector<hrm::Index> landmarks = landmark.landmarks;
+    ASSERT_EQ(landmarks.size(), 4);
+
+    // Shortcut across the bottom of the wall, and a new vertex on the other
+    // side of the roadmap
+    const hrm::Index i = size / 2;
+    graph.edge.emplace_back((i - 1) * size, (i + 1) * size);
+    graph.weight.push_back(2.0);
+
+    graph.vertex.push_back({-1.0, 0.0});
+    graph.edge.emplace_back(0, size * size);
+    graph.weight.push_back(1.0);
+
+    // Landmarks are kept, distances are repaired to the exact ones
+    hrm::planners::RoadmapSearch roadmap(graph, landmark);
+    roadmap.updateLandmarks(4);
+    EXPECT_EQ(landmark.landmarks, landmarks);
+    EXPECT_EQ(landmark.numEdge, graph.edge.size());
+
+    for (size_t k = 0; k < landmarks.size(); ++k) {
+        ASSERT_EQ(landmark.dist.at(k).size(), graph.vertex.size());
+        for (size_t v = 0; v < graph.vertex.size(); ++v) {
+            const auto res = roadmap.search(landmarks.at(k), v, 0);
+            if (res.solved) {
+                EXPECT_NEAR(landmark.dist.at(k).at(v), res.cost,
+                            hrm::EPSILON);
+            } else {
+                EXPECT_TRUE(std::isinf(landmark.dist.at(k).at(v)));
+            }
+        }
+    }
+
+    // Landmarks are selected again after the roadmap is replaced
+    const hrm::Graph smallGraph = generateGridRoadmap(size / 2);
+    hrm::planners::RoadmapSearch smallRoadmap(smallGraph, landmark);
+    smallRoadmap.updateLandmarks(4);
+    EXPECT_EQ(landmark.numVertexSelected, smallGraph.vertex.size());
+    EXPECT_EQ(landmark.dist.at(0).size(), smallGraph.vertex.size());
+}
+
+int main(int ac, char* av[]) {
+    testing::InitGoogleTest(&ac, av);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+/** \author Sipu Ruan */
+
+#include "hrm/config.h"
+#include "hrm/test/util/ParsePlanningSettings.h"
+#include "hrm/test/util/SceneGenerator.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+TEST(TestSceneGenerator, Reproducibility) {
+    hrm::SceneParameter param;
+    param.numObstacle = 50;
+    param.numPassage = 2;
+    param.seed = 7;
+
+    const auto scene = hrm::generateScene3D(param);
+    const auto sceneSame = hrm::generateScene3D(param);
+    EXPECT_EQ(scene.obstacle, sceneSame.obstacle);
+    EXPECT_EQ(scene.endPoints, sceneSame.endPoints);
+
+    param.seed = 8;
+    const auto sceneOther = hrm::generateScene3D(param);
+    EXPECT_NE(scene.obstacle, sceneOther.obstacle);
+}
+
+TEST(TestSceneGenerator, ObstacleAndPassage3D) {
+    hrm::SceneParameter param;
+    param.arenaSemiAxis = {200.0, 100.0, 100.0};
+    param.numObstacle = 200;
+    param.numPassage = 3;
+    param.passageWidth = 6.0;
+
+    const auto scene = hrm::generateScene3D(param);
+    ASSERT_EQ(scene.arena.size(), 1);
+    ASSERT_EQ(scene.endPoints.size(), 2);
+    ASSERT_EQ(scene.endPoints.at(0).size(), 7);
+
+    // Each wall has four pieces around the passage
+    const size_t numWall = 4 * param.numPassage;
+    ASSERT_EQ(scene.obstacle.size(), numWall + param.numObstacle);
+
+    for (size_t i = 0; i < scene.obstacle.size(); ++i) {
+        const auto& obstacle = scene.obstacle.at(i);
+        ASSERT_EQ(obstacle.size(), 12);
+
+        // Passage width between the pieces along y-axis
+        if (i < numWall && i % 4 == 0) {
+            const auto& next = scene.obstacle.at(i + 1);
+            EXPECT_NEAR((next[6] - next[1]) - (obstacle[6] + obstacle[1]),
+                        param.passageWidth, 1e-9);
+        }
+
+        // Random obstacles keep away from start and goal
+        if (i >= numWall) {
+            const double radius =
+                std::fmax(obstacle[0], std::fmax(obstacle[1], obstacle[2]));
+            for (const auto& end : scene.endPoints) {
+                const double dist = std::sqrt(
+                    std::pow(obstacle[5] - end[0], 2.0) +
+                    std::pow(obstacle[6] - end[1], 2.0) +
+                    std::pow(obstacle[7] - end[2], 2.0));
+                EXPECT_GE(dist, radius + param.endPointClearance);
+            }
+        }
+    }
+}
+
+TEST(TestSceneGenerator, LoadScene) {
+    hrm::SceneParameter param;
+    param.numObstacle = 20;
+    param.numPassage = 1;
+
+    // 2D scene
+    const auto scene2D = hrm::generateScene2D(param);
+    hrm::storeScene(scene2D, "superellipse", "generated_test", "2D",
+                    RESOURCES_PATH "/2D");
+    hrm::parsePlanningConfig("superellipse", "generated_test", "rabbit", "2D");
+
+    hrm::PlannerSetting2D env2D(50);
+    env2D.loadEnvironment(CONFIG_PATH "/");
+    EXPECT_EQ(env2D.getArena().size(), 1);
+    EXPECT_EQ(env2D.getObstacle().size(), scene2D.obstacle.size());
+    EXPECT_EQ(env2D.getEndPoints().size(), 2);
+
+    // 3D scene, end points padded for articulated robots
+    const auto scene3D = hrm::generateScene3D(param);
+    hrm::storeScene(scene3D, "superquadrics", "generated_test", "3D",
+                    RESOURCES_PATH "/3D");
+    hrm::parsePlanningConfig("superquadrics", "generated_test", "snake", "3D");
+
+    hrm::PlannerSetting3D env3D(10);
+    env3D.loadEnvironment(CONFIG_PATH "/");
+    EXPECT_EQ(env3D.getArena().size(), 1);
+    EXPECT_EQ(env3D.getObstacle().size(), scene3D.obstacle.size());
+    ASSERT_EQ(env3D.getEndPoints().size(), 2);
+    EXPECT_EQ(env3D.getEndPoints().at(0).size(), 10);
+}
+
+int main(int ac, char* av[]) {
+    testing::InitGoogleTest(&ac, av);
+    return RUN_ALL_TESTS();
+}
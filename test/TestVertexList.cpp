@@ -0,0 +1,129 @@
+/** \author Sipu Ruan */
+
+#include "hrm/datastructure/VertexList.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+/** \brief Vertices on the sweep-line lattice of 3D C-slices
+ * \param numSlice Number of C-slices
+ * \param numLine Number of sweep lines along x- and y-axes
+ * \param numPerLine Number of vertices on each sweep line
+ * \return List of configurations */
+std::vector<std::vector<hrm::Coordinate>> generateLatticeVertices3D(
+    const hrm::Index numSlice, const hrm::Index numLine,
+    const hrm::Index numPerLine) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> position(-50.0, 50.0);
+
+    std::vector<std::vector<hrm::Coordinate>> vertex;
+    for (size_t s = 0; s < numSlice; ++s) {
+        const double angle = 0.1 * static_cast<double>(s);
+        for (size_t i = 0; i < numLine; ++i) {
+            for (size_t j = 0; j < numLine; ++j) {
+                for (size_t k = 0; k < numPerLine; ++k) {
+                    vertex.push_back({-50.0 + 0.37 * static_cast<double>(i),
+                                      -50.0 + 0.41 * static_cast<double>(j),
+                                      position(generator), std::cos(angle),
+                                      std::sin(angle), 0.0, 0.0});
+                }
+            }
+        }
+    }
+
+    return vertex;
+}
+
+}  // namespace
+
+TEST(TestVertexList, LatticeVertices3D) {
+    const auto vertex = generateLatticeVertices3D(5, 20, 3);
+
+    hrm::VertexList vertexList;
+    vertexList.setLayout(3);
+    for (const auto& v : vertex) {
+        vertexList.push_back(v);
+    }
+    ASSERT_EQ(vertexList.size(), vertex.size());
+    EXPECT_EQ(vertexList.getNumException(), 0);
+
+    // Lattice and shape are exact, the coordinate along sweep line is in
+    // single precision
+    std::vector<hrm::Coordinate> v;
+    for (size_t i = 0; i < vertex.size(); ++i) {
+        vertexList.decode(i, v);
+        ASSERT_EQ(v.size(), vertex.at(i).size());
+        EXPECT_EQ(v.at(0), vertex.at(i).at(0));
+        EXPECT_EQ(v.at(1), vertex.at(i).at(1));
+        EXPECT_NEAR(v.at(2), vertex.at(i).at(2), 1e-5);
+        for (size_t k = 3; k < v.size(); ++k) {
+            EXPECT_EQ(v.at(k), vertex.at(i).at(k));
+            EXPECT_EQ(vertexList.getCoordinate(i, k), v.at(k));
+        }
+        EXPECT_EQ(vertexList.getCoordinate(i, 2), v.at(2));
+    }
+
+    // Distances between decoded vertices
+    for (size_t i = 1; i < vertex.size(); i += 97) {
+        const auto v1 = vertexList[i - 1];
+        const auto v2 = vertexList[i];
+        double dist = 0.0;
+        for (size_t k = 0; k < v1.size(); ++k) {
+            dist += (v1.at(k) - v2.at(k)) * (v1.at(k) - v2.at(k));
+        }
+        EXPECT_NEAR(vertexList.getDistance(i - 1, i), std::sqrt(dist), 1e-9);
+    }
+
+    // Memory reduction from the plain list of configurations, including the
+    // spare capacity of the codes
+    const hrm::Index memoryPlain =
+        vertex.size() * (sizeof(vertex.front()) +
+                         vertex.front().size() * sizeof(hrm::Coordinate));
+    EXPECT_LT(3 * vertexList.getMemorySize(), memoryPlain);
+    EXPECT_THROW(vertexList.at(vertex.size()), std::out_of_range);
+}
+
+TEST(TestVertexList, ExceptionAndAppend) {
+    // Without layout, all the vertices are kept in full
+    hrm::VertexList general = {{0.0, 0.0}, {1.0, 0.0}, {5.0, 0.0}};
+    EXPECT_EQ(general.size(), 3);
+    EXPECT_EQ(general.getNumException(), 3);
+    EXPECT_EQ(general.at(2), std::vector<hrm::Coordinate>({5.0, 0.0}));
+    EXPECT_DOUBLE_EQ(general.getDistance(0, 2), 5.0);
+
+    // 2D vertices, including one off the layout
+    hrm::VertexList vertexList;
+    vertexList.setLayout(2);
+    vertexList.push_back({1.5, -2.0, 0.5});
+    vertexList.push_back({2.5, -2.0, 0.5});
+    vertexList.push_back({NAN, 1.0, 0.5});
+    EXPECT_EQ(vertexList.getNumException(), 1);
+    EXPECT_EQ(vertexList.at(1), std::vector<hrm::Coordinate>({2.5, -2.0, 0.5}));
+    EXPECT_TRUE(std::isnan(vertexList.getCoordinate(2, 0)));
+
+    // Bridge vertices are kept in full even if they follow the layout
+    vertexList.pushException({2.0, -1.9, 0.5});
+    EXPECT_EQ(vertexList.getNumException(), 2);
+    EXPECT_EQ(vertexList.at(3), std::vector<hrm::Coordinate>({2.0, -1.9, 0.5}));
+    EXPECT_EQ(vertexList.getCoordinate(3, 1), -1.9);
+
+    // Vertices kept in full stay in the exception table
+    vertexList.append(general);
+    ASSERT_EQ(vertexList.size(), 7);
+    EXPECT_EQ(vertexList.getNumException(), 5);
+    EXPECT_EQ(vertexList.at(5), general.at(1));
+    EXPECT_EQ(vertexList.at(0), std::vector<hrm::Coordinate>({1.5, -2.0, 0.5}));
+
+    vertexList.clear();
+    EXPECT_TRUE(vertexList.empty());
+    EXPECT_EQ(vertexList.getNumException(), 0);
+}
+
+int main(int ac, char* av[]) {
+    testing::InitGoogleTest(&ac, av);
+    return RUN_ALL_TESTS();
+}
@@ -2,6 +2,8 @@
 
 #include "hrm/config.h"
 #include "hrm/planners/HRM2D.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
+#include "hrm/test/util/DisplayPlanningData.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
 #include <eigen3/Eigen/Dense>
@@ -20,7 +22,9 @@ int main(int argc, char** argv) {
         std::cout << "----------" << std::endl;
     } else {
         std::cerr << "Usage: Please add 1) Map type 2) Robot type 3) Num of "
-                     "trials 4) Num of slices 5) [optional] Num of sweep lines"
+                     "trials 4) Num of slices 5) [optional] Num of sweep lines "
+                     "6) [optional] Format for storing graph and path of the "
+                     "last trial (csv/bin)"
                   << std::endl;
         return 1;
     }
@@ -32,6 +36,7 @@ int main(int argc, char** argv) {
     const int numSlice = atoi(argv[4]);
 
     const int numLineY = argc > 5 ? atoi(argv[5]) : 0;
+    const std::string storeFormat = argc > 6 ? argv[6] : "";
 
     const int NUM_CURVE_PARAM = 50;
     const double MAX_PLAN_TIME = 10.0;
@@ -62,12 +67,20 @@ int main(int argc, char** argv) {
     req.start = env2D.getEndPoints().at(0);
     req.goal = env2D.getEndPoints().at(1);
 
+    // Records in common benchmark schema
+    hrm::BenchmarkRecorder recorder("BenchHRM2D");
+    recorder.setMetadata("map_type", mapType);
+    recorder.setMetadata("robot_type", robotType);
+    recorder.setMetadata("max_plan_time", MAX_PLAN_TIME);
+    recorder.setParameters(param);
+
     // Multiple planning trials
     std::cout << "Start benchmark..." << std::endl;
     std::cout << " Map type: [" << mapType << "]; Robot type: [" << robotType
               << "]" << std::endl;
 
     std::vector<std::vector<double>> timeStatistics;
+    std::vector<std::pair<hrm::Time, hrm::OperationCount>> phaseStatistics;
     for (int i = 0; i < numTrial; i++) {
         std::cout << "Number of trials: " << i + 1 << std::endl;
 
@@ -76,6 +89,8 @@ int main(int argc, char** argv) {
         hrm.plan(MAX_PLAN_TIME);
 
         const auto res = hrm.getPlanningResult();
+        recorder.addTrial(
+            "HRM2D", hrm::getPlanningMetrics(res, hrm.getPlannerParameters()));
 
         // Store statistics
         timeStatistics.push_back(
@@ -84,6 +99,7 @@ int main(int argc, char** argv) {
              static_cast<double>(res.graphStructure.vertex.size()),
              static_cast<double>(res.graphStructure.edge.size()),
              static_cast<double>(res.solutionPath.PathId.size())});
+        phaseStatistics.emplace_back(res.planningTime, res.operationCount);
 
         // Planning Time and Path Cost
         std::cout << "Roadmap build time: " << res.planningTime.buildTime << "s"
@@ -100,6 +116,15 @@ int main(int argc, char** argv) {
         std::cout << "Number of configurations in Path: "
                   << res.solutionPath.PathId.size() << std::endl;
         std::cout << "Cost: " << res.solutionPath.cost << std::endl;
+        hrm::displayOperationCountInfo(res.operationCount);
+
+        if (!storeFormat.empty() && i == numTrial - 1) {
+            const auto format = storeFormat == "bin"
+                                    ? hrm::DataFileFormat::BINARY
+                                    : hrm::DataFileFormat::CSV;
+            hrm::storeGraphInfo(res.graphStructure, "hrm_2D", format);
+            hrm::storePathInfo(res.solutionPath, "hrm_2D", format);
+        }
     }
 
     // Store results
@@ -107,17 +132,23 @@ int main(int argc, char** argv) {
     fileTimeStatistics.open(BENCHMARK_DATA_PATH "/time_hrm_2D.csv");
     fileTimeStatistics << "BUILD_TIME" << ',' << "SEARCH_TIME" << ','
                        << "PLAN_TIME" << ',' << "GRAPH_NODE" << ','
-                       << "GRAPH_EDGE" << ',' << "PATH_NODE"
-                       << "\n";
+                       << "GRAPH_EDGE" << ',' << "PATH_NODE";
+    hrm::storeStatisticsHeader(fileTimeStatistics);
+    fileTimeStatistics << "\n";
     for (size_t i = 0; i < static_cast<size_t>(numTrial); i++) {
         fileTimeStatistics << timeStatistics[i][0] << ','
                            << timeStatistics[i][1] << ','
                            << timeStatistics[i][2] << ','
                            << timeStatistics[i][3] << ','
                            << timeStatistics[i][4] << ','
-                           << timeStatistics[i][5] << "\n";
+                           << timeStatistics[i][5];
+        hrm::storeStatistics(phaseStatistics[i].first,
+                             phaseStatistics[i].second, fileTimeStatistics);
+        fileTimeStatistics << "\n";
     }
     fileTimeStatistics.close();
 
+    recorder.store(BENCHMARK_DATA_PATH "/bench_hrm_2D.json");
+
     return 0;
 }
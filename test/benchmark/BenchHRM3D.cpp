@@ -2,6 +2,7 @@
 
 #include "hrm/config.h"
 #include "hrm/planners/HRM3D.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
 #include "hrm/test/util/DisplayPlanningData.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
@@ -18,7 +19,9 @@ int main(int argc, char** argv) {
             << "Usage: Please add 1) Map type 2) Robot type 3) Num of trials "
                "4) Max planning time 5) Num of slices 6) Method for "
                "pre-defined SO(3) samples 7) [optional] Num of sweep lines "
-               "(x-direction) 8) [optional] Num of sweep lines (y-direction)"
+               "(x-direction) 8) [optional] Num of sweep lines (y-direction) "
+               "9) [optional] Format for storing graph and path of the last "
+               "trial (csv/bin)"
             << std::endl;
         return 1;
     }
@@ -33,6 +36,7 @@ int main(int argc, char** argv) {
 
     const int numLineX = argc > 7 ? atoi(argv[7]) : 0;
     const int numLineY = argc > 7 ? atoi(argv[8]) : 0;
+    const std::string storeFormat = argc > 9 ? argv[9] : "";
 
     const int NUM_SURF_PARAM = 10;
 
@@ -68,6 +72,13 @@ int main(int argc, char** argv) {
     req.start = env3D.getEndPoints().at(0);
     req.goal = env3D.getEndPoints().at(1);
 
+    // Records in common benchmark schema
+    hrm::BenchmarkRecorder recorder("BenchHRM3D");
+    recorder.setMetadata("map_type", mapType);
+    recorder.setMetadata("robot_type", robotType);
+    recorder.setMetadata("max_plan_time", MAX_PLAN_TIME);
+    recorder.setParameters(param);
+
     // Store results
     std::ofstream fileTimeStatistics;
     fileTimeStatistics.open(BENCHMARK_DATA_PATH "/time_high_3D.csv");
@@ -75,8 +86,9 @@ int main(int argc, char** argv) {
                        << "SEARCH_TIME" << ',' << "PLAN_TIME" << ','
                        << "N_LAYERS" << ',' << "N_X" << ',' << "N_Y" << ','
                        << "GRAPH_NODE" << ',' << "GRAPH_EDGE" << ','
-                       << "PATH_NODE"
-                       << "\n";
+                       << "PATH_NODE";
+    hrm::storeStatisticsHeader(fileTimeStatistics);
+    fileTimeStatistics << "\n";
 
     // Benchmark
     std::cout << "Start benchmark..." << std::endl;
@@ -92,11 +104,14 @@ int main(int argc, char** argv) {
         hrm.plan(MAX_PLAN_TIME);
 
         const auto res = hrm.getPlanningResult();
+        recorder.addTrial(
+            "HRM3D", hrm::getPlanningMetrics(res, hrm.getPlannerParameters()));
 
         // Display and store results
         hrm::displayPlanningTimeInfo(res.planningTime);
         hrm::displayGraphInfo(res.graphStructure);
         hrm::displayPathInfo(res.solutionPath);
+        hrm::displayOperationCountInfo(res.operationCount);
 
         std::cout << "Final number of C-slices: "
                   << hrm.getPlannerParameters().numSlice << std::endl;
@@ -105,6 +120,14 @@ int main(int argc, char** argv) {
                   << hrm.getPlannerParameters().numLineY << '}' << std::endl;
         std::cout << "==========" << std::endl;
 
+        if (!storeFormat.empty() && i == numTrial - 1) {
+            const auto format = storeFormat == "bin"
+                                    ? hrm::DataFileFormat::BINARY
+                                    : hrm::DataFileFormat::CSV;
+            hrm::storeGraphInfo(res.graphStructure, "hrm_3D", format);
+            hrm::storePathInfo(res.solutionPath, "hrm_3D", format);
+        }
+
         fileTimeStatistics << static_cast<int>(res.solved) << ','
                            << res.planningTime.buildTime << ','
                            << res.planningTime.searchTime << ','
@@ -114,9 +137,14 @@ int main(int argc, char** argv) {
                            << hrm.getPlannerParameters().numLineY << ','
                            << res.graphStructure.vertex.size() << ','
                            << res.graphStructure.edge.size() << ','
-                           << res.solutionPath.PathId.size() << "\n";
+                           << res.solutionPath.PathId.size();
+        hrm::storeStatistics(res.planningTime, res.operationCount,
+                             fileTimeStatistics);
+        fileTimeStatistics << "\n";
     }
     fileTimeStatistics.close();
 
+    recorder.store(BENCHMARK_DATA_PATH "/bench_hrm_3D.json");
+
     return 0;
 }
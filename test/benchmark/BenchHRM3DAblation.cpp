@@ -2,6 +2,7 @@
 
 #include "hrm/config.h"
 #include "hrm/planners/HRM3DAblation.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
 #include "hrm/test/util/DisplayPlanningData.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
@@ -19,7 +20,9 @@ int main(int argc, char** argv) {
             << "Usage: Please add 1) Map type 2) Robot type 3) Num of trials "
                "4) Max planning time 5) Num of slices 6) Method for "
                "pre-defined SO(3) samples 7) [optional] Num of sweep lines "
-               "(x-direction) 8) [optional] Num of sweep lines (y-direction)"
+               "(x-direction) 8) [optional] Num of sweep lines (y-direction) "
+               "9) [optional] Continuous collision checking (0: interpolated "
+               "poses, 1: continuous)"
             << std::endl;
         return 1;
     }
@@ -33,7 +36,8 @@ int main(int argc, char** argv) {
     const std::string methodSO3 = argv[6];
 
     const int numLineX = argc > 7 ? atoi(argv[7]) : 0;
-    const int numLineY = argc > 7 ? atoi(argv[8]) : 0;
+    const int numLineY = argc > 8 ? atoi(argv[8]) : 0;
+    const bool isContinuousCollision = argc > 9 ? atoi(argv[9]) != 0 : false;
 
     const int NUM_SURF_PARAM = 10;
 
@@ -56,6 +60,7 @@ int main(int argc, char** argv) {
     param.numSlice = size_t(numSlice);
     param.numLineX = size_t(numLineX);
     param.numLineY = size_t(numLineY);
+    param.isContinuousCollision = isContinuousCollision;
     hrm::defineParameters(robot, env3D, param);
 
     std::cout << "Initial number of C-slices: " << param.numSlice << std::endl;
@@ -69,6 +74,13 @@ int main(int argc, char** argv) {
     req.start = env3D.getEndPoints().at(0);
     req.goal = env3D.getEndPoints().at(1);
 
+    // Records in common benchmark schema
+    hrm::BenchmarkRecorder recorder("BenchHRM3DAblation");
+    recorder.setMetadata("map_type", mapType);
+    recorder.setMetadata("robot_type", robotType);
+    recorder.setMetadata("max_plan_time", MAX_PLAN_TIME);
+    recorder.setParameters(param);
+
     // Store results
     std::ofstream fileTimeStatistics;
     fileTimeStatistics.open(BENCHMARK_DATA_PATH "/time_high_3D_ablation.csv");
@@ -76,8 +88,9 @@ int main(int argc, char** argv) {
                        << "SEARCH_TIME" << ',' << "PLAN_TIME" << ','
                        << "N_LAYERS" << ',' << "N_X" << ',' << "N_Y" << ','
                        << "GRAPH_NODE" << ',' << "GRAPH_EDGE" << ','
-                       << "PATH_NODE"
-                       << "\n";
+                       << "PATH_NODE";
+    hrm::storeStatisticsHeader(fileTimeStatistics);
+    fileTimeStatistics << "\n";
 
     // Benchmark
     std::cout << "Start benchmark..." << std::endl;
@@ -93,11 +106,15 @@ int main(int argc, char** argv) {
         hrm_ablation.plan(MAX_PLAN_TIME);
 
         const auto res = hrm_ablation.getPlanningResult();
+        recorder.addTrial(
+            "HRM3DAblation",
+            hrm::getPlanningMetrics(res, hrm_ablation.getPlannerParameters()));
 
         // Display and store results
         hrm::displayPlanningTimeInfo(res.planningTime);
         hrm::displayGraphInfo(res.graphStructure);
         hrm::displayPathInfo(res.solutionPath);
+        hrm::displayOperationCountInfo(res.operationCount);
 
         std::cout << "Final number of C-slices: "
                   << hrm_ablation.getPlannerParameters().numSlice << std::endl;
@@ -117,9 +134,14 @@ int main(int argc, char** argv) {
                            << hrm_ablation.getPlannerParameters().numLineY
                            << ',' << res.graphStructure.vertex.size() << ','
                            << res.graphStructure.edge.size() << ','
-                           << res.solutionPath.PathId.size() << "\n";
+                           << res.solutionPath.PathId.size();
+        hrm::storeStatistics(res.planningTime, res.operationCount,
+                             fileTimeStatistics);
+        fileTimeStatistics << "\n";
     }
     fileTimeStatistics.close();
 
+    recorder.store(BENCHMARK_DATA_PATH "/bench_hrm_3D_ablation.json");
+
     return 0;
 }
@@ -0,0 +1,421 @@
+/** \author Sipu Ruan */
+
+#include "hrm/config.h"
+#include "hrm/datastructure/Interval.h"
+#include "hrm/geometry/LineIntersection.h"
+#include "hrm/geometry/MeshGenerator.h"
+#include "hrm/geometry/SuperEllipse.h"
+#include "hrm/geometry/SuperQuadrics.h"
+#include "hrm/geometry/TightFitEllipsoid.h"
+#include "hrm/planners/RoadmapSearch.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
+#include "hrm/util/DistanceMetric.h"
+#include "hrm/util/EllipsoidSeparation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+using Clock = std::chrono::high_resolution_clock;
+using Durationd = std::chrono::duration<double>;
+
+/** \brief Minimum duration of one timed sample in seconds, kernels are
+ * repeated in batches to reach it */
+const double MIN_SAMPLE_TIME = 1e-3;
+
+/** \brief Sink of kernel outputs, prevents the calls from being optimized
+ * away */
+volatile double sink = 0.0;
+
+/** \brief Statistics of time per kernel call, in microseconds */
+struct KernelStatistics {
+    double median = 0.0;
+    double min = 0.0;
+    double mean = 0.0;
+    double stdDev = 0.0;
+
+    /** \brief Sorted samples */
+    std::vector<double> samples;
+};
+
+/** \brief Time a kernel. The batch size is calibrated first, then the time
+ * per call is sampled and summarized. Median is robust to outliers caused
+ * by other processes
+ * \param kernel Function to be timed, returns a value fed into the sink
+ * \param numSample Number of timed samples
+ * \return KernelStatistics */
+KernelStatistics benchmarkKernel(const std::function<double()>& kernel,
+                                 const size_t numSample) {
+    auto timeBatch = [&kernel](const size_t numBatch) {
+        const auto start = Clock::now();
+        for (size_t i = 0; i < numBatch; ++i) {
+            sink = sink + kernel();
+        }
+        return Durationd(Clock::now() - start).count();
+    };
+
+    // Warm up caches, then calibrate the batch size
+    timeBatch(1);
+    size_t numBatch = 1;
+    while (timeBatch(numBatch) < MIN_SAMPLE_TIME && numBatch < (1 << 20)) {
+        numBatch *= 2;
+    }
+
+    std::vector<double> samples(numSample);
+    for (auto& sample : samples) {
+        sample = timeBatch(numBatch) / double(numBatch) * 1e6;
+    }
+    std::sort(samples.begin(), samples.end());
+
+    KernelStatistics stats;
+    stats.median = samples.at(samples.size() / 2);
+    stats.min = samples.front();
+    stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) /
+                 double(samples.size());
+    for (const auto sample : samples) {
+        stats.stdDev += (sample - stats.mean) * (sample - stats.mean);
+    }
+    stats.stdDev = std::sqrt(stats.stdDev / double(samples.size()));
+    stats.samples = samples;
+
+    return stats;
+}
+
+/** \brief Random superquadric obstacles with fixed seed
+ * \param numObstacle Number of obstacles
+ * \param numSurfParam Number of sampled points on each surface
+ * \param isEllipsoid Whether the exponents are fixed to 1
+ * \return List of obstacles */
+std::vector<hrm::SuperQuadrics> generateObstacles(const size_t numObstacle,
+                                                  const hrm::Index numSurfParam,
+                                                  const bool isEllipsoid) {
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> position(-50.0, 50.0);
+    std::uniform_real_distribution<double> semiAxis(2.0, 10.0);
+    std::uniform_real_distribution<double> epsilon(0.2, 1.8);
+    std::normal_distribution<double> quaternion(0.0, 1.0);
+
+    std::vector<hrm::SuperQuadrics> obstacles;
+    for (size_t i = 0; i < numObstacle; ++i) {
+        Eigen::Quaterniond quat(quaternion(generator), quaternion(generator),
+                                quaternion(generator), quaternion(generator));
+        quat.normalize();
+
+        obstacles.emplace_back(
+            std::vector<double>{semiAxis(generator), semiAxis(generator),
+                                semiAxis(generator)},
+            isEllipsoid
+                ? std::vector<double>{1.0, 1.0}
+                : std::vector<double>{epsilon(generator), epsilon(generator)},
+            std::vector<double>{position(generator), position(generator),
+                                position(generator)},
+            quat, numSurfParam);
+    }
+
+    return obstacles;
+}
+
+/** \brief Random superelliptic obstacles with fixed seed
+ * \param numObstacle Number of obstacles
+ * \param numSurfParam Number of sampled points on each curve
+ * \return List of obstacles */
+std::vector<hrm::SuperEllipse> generateObstacles2D(
+    const size_t numObstacle, const hrm::Index numSurfParam) {
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> position(-50.0, 50.0);
+    std::uniform_real_distribution<double> semiAxis(2.0, 10.0);
+    std::uniform_real_distribution<double> epsilon(0.2, 1.8);
+    std::uniform_real_distribution<double> angle(-hrm::PI, hrm::PI);
+
+    std::vector<hrm::SuperEllipse> obstacles;
+    for (size_t i = 0; i < numObstacle; ++i) {
+        obstacles.emplace_back(
+            std::vector<double>{semiAxis(generator), semiAxis(generator)},
+            epsilon(generator),
+            std::vector<double>{position(generator), position(generator)},
+            angle(generator), numSurfParam);
+    }
+
+    return obstacles;
+}
+
+/** \brief Layered grid roadmap, similar to connected C-slices
+ * \param side Number of vertices along each side of one layer
+ * \param numLayer Number of layers
+ * \return Graph structure */
+hrm::Graph generateGridGraph(const size_t side, const size_t numLayer) {
+    hrm::Graph graph;
+    auto id = [side](const size_t i, const size_t j, const size_t k) {
+        return (k * side + j) * side + i;
+    };
+    auto addEdge = [&graph](const hrm::Index u, const hrm::Index v) {
+        graph.edge.emplace_back(u, v);
+        graph.weight.push_back(hrm::vectorEuclidean(graph.vertex.at(u),
+                                                    graph.vertex.at(v)));
+    };
+
+    for (size_t k = 0; k < numLayer; ++k) {
+        for (size_t j = 0; j < side; ++j) {
+            for (size_t i = 0; i < side; ++i) {
+                graph.vertex.push_back(
+                    {double(i), double(j), 0.0, 1.0, 0.0, 0.0, 0.0});
+            }
+        }
+    }
+
+    for (size_t k = 0; k < numLayer; ++k) {
+        for (size_t j = 0; j < side; ++j) {
+            for (size_t i = 0; i < side; ++i) {
+                if (i + 1 < side) {
+                    addEdge(id(i, j, k), id(i + 1, j, k));
+                }
+                if (j + 1 < side) {
+                    addEdge(id(i, j, k), id(i, j + 1, k));
+                }
+                if (k + 1 < numLayer) {
+                    addEdge(id(i, j, k), id(i, j, k + 1));
+                }
+            }
+        }
+    }
+
+    return graph;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 2) {
+        std::cout << "Benchmark: geometry and search kernels" << std::endl;
+        std::cout << "----------" << std::endl;
+    } else {
+        std::cerr << "Usage: Please add 1) Num of timed samples per kernel"
+                  << std::endl;
+        return 1;
+    }
+
+    const auto numSample = size_t(std::max(atoi(argv[1]), 1));
+
+    const std::vector<hrm::Index> numSurfParamList = {10, 20, 40};
+    const std::vector<size_t> numObstacleList = {1, 10, 100};
+
+    // Store results
+    std::ofstream fileTimeStatistics;
+    fileTimeStatistics.open(BENCHMARK_DATA_PATH "/time_kernels.csv");
+    fileTimeStatistics << "KERNEL" << ',' << "NUM_SURF_PARAM" << ','
+                       << "NUM_OBSTACLE" << ',' << "MEDIAN_US" << ','
+                       << "MIN_US" << ',' << "MEAN_US" << ',' << "STD_US"
+                       << "\n";
+
+    hrm::BenchmarkRecorder recorder("BenchKernels");
+    recorder.setMetadata("num_sample", double(numSample));
+
+    auto record = [&](const std::string& kernelName,
+                      const hrm::Index numSurfParam, const size_t numObstacle,
+                      const std::function<double()>& kernel) {
+        const auto stats = benchmarkKernel(kernel, numSample);
+
+        std::cout << std::left << std::setw(34) << kernelName << " n="
+                  << std::setw(4) << numSurfParam << " obs=" << std::setw(4)
+                  << numObstacle << " median: " << stats.median
+                  << " us; min: " << stats.min << " us; std: " << stats.stdDev
+                  << " us" << std::endl;
+
+        fileTimeStatistics << kernelName << ',' << numSurfParam << ','
+                           << numObstacle << ',' << stats.median << ','
+                           << stats.min << ',' << stats.mean << ','
+                           << stats.stdDev << "\n";
+
+        const std::string caseName = kernelName + " n=" +
+                                     std::to_string(numSurfParam) +
+                                     " obs=" + std::to_string(numObstacle);
+        for (const auto sample : stats.samples) {
+            recorder.addTrial(caseName, {{"TIME_US", sample}});
+        }
+    };
+
+    // Kernels parameterized by mesh resolution and number of obstacles, each
+    // call processes all the obstacles as in one C-slice
+    for (const auto numSurfParam : numSurfParamList) {
+        const hrm::SuperQuadrics robot({5.0, 3.0, 2.0}, {1.0, 1.0},
+                                       {0.0, 0.0, 0.0},
+                                       Eigen::Quaterniond::Identity(),
+                                       numSurfParam);
+        const hrm::SuperEllipse robot2D({5.0, 3.0}, 1.0, {0.0, 0.0}, 0.0,
+                                        numSurfParam);
+
+        for (const auto numObstacle : numObstacleList) {
+            const auto obstacles =
+                generateObstacles(numObstacle, numSurfParam, false);
+            const auto obstacles2D =
+                generateObstacles2D(numObstacle, numSurfParam);
+
+            record("SuperQuadrics::getMinkSum3D", numSurfParam, numObstacle,
+                   [&]() {
+                       double sum = 0.0;
+                       for (const auto& obstacle : obstacles) {
+                           sum += obstacle.getMinkSum3D(robot, +1)(0, 0);
+                       }
+                       return sum;
+                   });
+
+            record("SuperEllipse::getMinkSum2D", numSurfParam, numObstacle,
+                   [&]() {
+                       double sum = 0.0;
+                       for (const auto& obstacle : obstacles2D) {
+                           sum += obstacle.getMinkSum2D(robot2D, +1)(0, 0);
+                       }
+                       return sum;
+                   });
+
+            std::vector<hrm::BoundaryPoints> minkSum;
+            for (const auto& obstacle : obstacles) {
+                minkSum.push_back(obstacle.getMinkSum3D(robot, +1));
+            }
+
+            record("getMeshFromParamSurface", numSurfParam, numObstacle,
+                   [&]() {
+                       double sum = 0.0;
+                       for (const auto& surface : minkSum) {
+                           sum += hrm::getMeshFromParamSurface(surface,
+                                                               numSurfParam)
+                                      .vertices(0, 0);
+                       }
+                       return sum;
+                   });
+
+            // Vertical lines through the center of each obstacle
+            std::vector<hrm::MeshMatrix> meshes;
+            std::vector<hrm::Line3D> lines;
+            for (size_t i = 0; i < minkSum.size(); ++i) {
+                meshes.push_back(
+                    hrm::getMeshFromParamSurface(minkSum.at(i), numSurfParam));
+
+                hrm::Line3D line(6);
+                line << obstacles.at(i).getPosition().at(0),
+                    obstacles.at(i).getPosition().at(1), 0.0, 0.0, 0.0, 1.0;
+                lines.push_back(line);
+            }
+
+            record("intersectVerticalLineMesh3D", numSurfParam, numObstacle,
+                   [&]() {
+                       double sum = 0.0;
+                       for (size_t i = 0; i < meshes.size(); ++i) {
+                           sum += double(hrm::intersectVerticalLineMesh3D(
+                                             lines.at(i), meshes.at(i))
+                                             .size());
+                       }
+                       return sum;
+                   });
+
+            // Same-slice check of a segment across the 2D C-obstacles
+            std::vector<hrm::BoundaryPoints> minkSum2D;
+            std::vector<Eigen::AlignedBox2d> boxes2D;
+            for (const auto& obstacle : obstacles2D) {
+                minkSum2D.push_back(obstacle.getMinkSum2D(robot2D, +1));
+                boxes2D.push_back(hrm::getBoundingBox2D(minkSum2D.back()));
+            }
+            const auto seg = std::make_pair(std::vector<double>{-50.0, -5.0},
+                                            std::vector<double>{50.0, 5.0});
+
+            record("isIntersectSegPolygon2D", numSurfParam, numObstacle,
+                   [&]() {
+                       double sum = 0.0;
+                       for (size_t i = 0; i < minkSum2D.size(); ++i) {
+                           if (hrm::isIntersectSegBox2D(seg, boxes2D.at(i)) &&
+                               hrm::isIntersectSegPolygon2D(
+                                   seg, minkSum2D.at(i))) {
+                               sum += 1.0;
+                           }
+                       }
+                       return sum;
+                   });
+        }
+
+        // Tightly-fitted ellipsoid depends only on the resolution
+        const Eigen::Quaterniond quatB(
+            Eigen::AngleAxisd(hrm::HALF_PI, Eigen::Vector3d::UnitZ()));
+        record("getTFE3D", numSurfParam, 0, [&]() {
+            return hrm::getTFE3D(robot.getSemiAxis(),
+                                 Eigen::Quaterniond::Identity(), quatB, 5,
+                                 numSurfParam)
+                .getSemiAxis()
+                .at(0);
+        });
+    }
+
+    // Kernels parameterized by number of obstacles only
+    for (const auto numObstacle : numObstacleList) {
+        // Two intervals per obstacle on each sweep line
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<double> coordinate(-50.0, 50.0);
+        std::vector<hrm::Interval> intervals;
+        for (size_t i = 0; i < 2 * numObstacle; ++i) {
+            const double s = coordinate(generator);
+            intervals.emplace_back(s, s + 5.0);
+        }
+        const std::vector<hrm::Interval> bound = {
+            hrm::Interval(-60.0, 60.0)};
+
+        record("Interval::unions", 0, numObstacle, [&]() {
+            return double(hrm::Interval::unions(intervals).size());
+        });
+
+        record("Interval::intersects", 0, numObstacle, [&]() {
+            return double(hrm::Interval::intersects(intervals).size());
+        });
+
+        const auto obsUnion = hrm::Interval::unions(intervals);
+        record("Interval::complements", 0, numObstacle, [&]() {
+            return double(hrm::Interval::complements(bound, obsUnion).size());
+        });
+
+        // Separation of one robot body against all ellipsoidal obstacles
+        const auto ellipsoids = generateObstacles(numObstacle, 10, true);
+        const auto batch = hrm::getEllipsoidBatch(ellipsoids);
+        std::vector<Eigen::Matrix4d> poses(64, Eigen::Matrix4d::Identity());
+        for (auto& pose : poses) {
+            pose.topRightCorner(3, 1) << coordinate(generator),
+                coordinate(generator), coordinate(generator);
+        }
+        const Eigen::Vector3d semiAxis(5.0, 3.0, 2.0);
+
+        size_t poseId = 0;
+        record("isEllipsoidSeparated", 0, numObstacle, [&]() {
+            poseId = (poseId + 1) % poses.size();
+            return double(
+                hrm::isEllipsoidSeparated(semiAxis, poses[poseId], batch));
+        });
+    }
+
+    // Roadmap search on layered grids, with one layer per C-slice and the
+    // layer side growing with the resolution
+    for (const auto numSurfParam : numSurfParamList) {
+        const hrm::Graph graph =
+            generateGridGraph(2 * size_t(numSurfParam), 10);
+        hrm::planners::RoadmapSearch roadmapSearch(graph);
+        roadmapSearch.computeLandmarks(8);
+
+        const hrm::Index target = graph.vertex.size() - 1;
+        const std::vector<std::string> strategyName = {
+            "RoadmapSearch::AStar", "RoadmapSearch::BidirectionalAStar",
+            "RoadmapSearch::ALT", "RoadmapSearch::WeightedAStar"};
+        for (size_t strategy = 0; strategy < strategyName.size();
+             ++strategy) {
+            record(strategyName.at(strategy), numSurfParam, 0, [&]() {
+                return roadmapSearch.search(0, target, strategy, 1.5).cost;
+            });
+        }
+    }
+
+    fileTimeStatistics.close();
+
+    recorder.store(BENCHMARK_DATA_PATH "/bench_kernels.json");
+
+    return 0;
+}
@@ -2,19 +2,21 @@
 
 #include "hrm/config.h"
 #include "hrm/planners/ompl_interface/OMPL3D.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
 namespace ho = hrm::planners::ompl_interface;
 
 int main(int argc, char** argv) {
-    if (argc == 8) {
+    if (argc >= 9) {
         std::cout << "Benchmark: OMPL for 3D rigid-body planning" << std::endl;
         std::cout << "----------" << std::endl;
     } else {
         std::cerr
             << "Usage: Please add 1) Map type 2) Robot type 3) Num of trials "
                "4) Planner start ID 5) Planner end ID 6) Sampler start ID 7) "
-               "Sampler end ID 8) Max planning time (in seconds)"
+               "Sampler end ID 8) Max planning time (in seconds) 9) "
+               "[optional] Motion validator ID (0: discrete, 1: clearance)"
             << std::endl;
         return 1;
     }
@@ -33,6 +35,7 @@ int main(int argc, char** argv) {
     const int idxSamplerStart = atoi(argv[6]);
     const int idxSamplerEnd = atoi(argv[7]);
     const auto MAX_PLAN_TIME = double(atoi(argv[8]));
+    const int idxMotionValidator = argc > 9 ? atoi(argv[9]) : 0;
 
     // Read and setup environment config
     hrm::parsePlanningConfig("superquadrics", mapType, robotType, "3D");
@@ -77,6 +80,13 @@ int main(int argc, char** argv) {
             << ',' << "PATH_CONFIG" << ',' << "VALID_SPACE" << ','
             << "CHECKED_NODES" << ',' << "VALID_NODES" << std::endl;
 
+    // Records in common benchmark schema
+    hrm::BenchmarkRecorder recorder("BenchOMPL3D");
+    recorder.setMetadata("map_type", mapType);
+    recorder.setMetadata("robot_type", robotType);
+    recorder.setMetadata("max_plan_time", MAX_PLAN_TIME);
+    recorder.setMetadata("motion_validator", double(idxMotionValidator));
+
     for (int m = idxPlannerStart; m <= idxPlannerEnd; m++) {
         for (int n = idxSamplerStart; n <= idxSamplerEnd; n++) {
             // Only PRM use different samplers
@@ -90,7 +100,7 @@ int main(int argc, char** argv) {
                 std::cout << "Num of trials: " << i + 1 << std::endl;
 
                 ho::OMPL3D omplPlanner(b1, b2, robot, arena, obs, obs_mesh);
-                omplPlanner.setup(m, n);
+                omplPlanner.setup(m, n, idxMotionValidator);
 
                 omplPlanner.plan(env3D.getEndPoints().at(0),
                                  env3D.getEndPoints().at(1), MAX_PLAN_TIME);
@@ -104,10 +114,17 @@ int main(int argc, char** argv) {
                         << omplPlanner.getValidStatePercent() << ','
                         << omplPlanner.getNumCollisionChecks() << ','
                         << omplPlanner.getNumValidStates() << std::endl;
+
+                const std::string caseName = "PLANNER_" + std::to_string(m) +
+                                             "_SAMPLER_" + std::to_string(n);
+                recorder.addTrial(caseName,
+                                  hrm::getOMPLPlanningMetrics(omplPlanner));
             }
         }
     }
     outfile.close();
 
+    recorder.store(BENCHMARK_DATA_PATH "/bench_ompl_3D.json");
+
     return 0;
 }
@@ -2,13 +2,14 @@
 
 #include "hrm/config.h"
 #include "hrm/planners/ompl_interface/OMPL3DArticulated.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
 namespace ho = hrm::planners::ompl_interface;
 
 int main(int argc, char** argv) {
     std::cout << argc;
-    if (argc >= 8) {
+    if (argc >= 9) {
         std::cout << "OMPL for 3D articulated-body planning" << std::endl;
         std::cout << "----------" << std::endl;
 
@@ -16,7 +17,8 @@ int main(int argc, char** argv) {
         std::cerr
             << "Usage: Please add 1) Map type 2) Robot type 3) Num of trials "
                "4) Planner start ID 5) Planner end ID 6) Sampler start ID 7) "
-               "Sampler end ID 8) Max planning time (in seconds)"
+               "Sampler end ID 8) Max planning time (in seconds) 9) "
+               "[optional] Motion validator ID (0: discrete, 1: clearance)"
             << std::endl;
         return 1;
     }
@@ -35,6 +37,7 @@ int main(int argc, char** argv) {
         const int idxSamplerStart = atoi(argv[6]);
         const int idxSamplerEnd = atoi(argv[7]);
         const auto MAX_PLAN_TIME = double(atoi(argv[8]));
+        const int idxMotionValidator = argc > 9 ? atoi(argv[9]) : 0;
 
         // Read and setup environment config
         hrm::parsePlanningConfig("superquadrics", mapType, robotType, "3D");
@@ -81,6 +84,13 @@ int main(int argc, char** argv) {
                 << ',' << "PATH_CONFIG" << ',' << "VALID_SPACE" << ','
                 << "CHECKED_NODES" << ',' << "VALID_NODES" << std::endl;
 
+        // Records in common benchmark schema
+        hrm::BenchmarkRecorder recorder("BenchOMPL3DArticulated");
+        recorder.setMetadata("map_type", mapType);
+        recorder.setMetadata("robot_type", robotType);
+        recorder.setMetadata("max_plan_time", MAX_PLAN_TIME);
+        recorder.setMetadata("motion_validator", double(idxMotionValidator));
+
         for (int m = idxPlannerStart; m <= idxPlannerEnd; m++) {
             for (int n = idxSamplerStart; n <= idxSamplerEnd; n++) {
                 // Only PRM use different samplers
@@ -95,7 +105,7 @@ int main(int argc, char** argv) {
 
                     ho::OMPL3DArticulated omplPlanner(b1, b2, robot, urdfFile,
                                                       arena, obs, obs_mesh);
-                    omplPlanner.setup(m, n);
+                    omplPlanner.setup(m, n, idxMotionValidator);
 
                     omplPlanner.plan(env3D.getEndPoints().at(0),
                                      env3D.getEndPoints().at(1), MAX_PLAN_TIME);
@@ -108,10 +118,18 @@ int main(int argc, char** argv) {
                             << omplPlanner.getValidStatePercent() << ','
                             << omplPlanner.getNumCollisionChecks() << ','
                             << omplPlanner.getNumValidStates() << std::endl;
+
+                    const std::string caseName =
+                        "PLANNER_" + std::to_string(m) + "_SAMPLER_" +
+                        std::to_string(n);
+                    recorder.addTrial(caseName,
+                                      hrm::getOMPLPlanningMetrics(omplPlanner));
                 }
             }
         }
         outfile.close();
 
+        recorder.store(BENCHMARK_DATA_PATH "/bench_ompl_articulated_3D.json");
+
         return 0;
     }
\ No newline at end of file
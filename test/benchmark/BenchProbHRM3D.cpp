@@ -2,6 +2,7 @@
 
 #include "hrm/config.h"
 #include "hrm/planners/ProbHRM3D.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
 #include "hrm/test/util/DisplayPlanningData.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
@@ -18,7 +19,7 @@ int main(int argc, char** argv) {
         std::cerr << "Usage: Please add 1) Map type 2) Robot type 3) Num of "
                      "trials 4) Max planning time (in seconds) 5) [optional] "
                      "Num of sweep lines (x-direction) 6) [optional] Num of "
-                     "sweep lines (y-direction)"
+                     "sweep lines (y-direction) 7) [optional] Num of threads"
                   << std::endl;
         return 1;
     }
@@ -31,6 +32,7 @@ int main(int argc, char** argv) {
 
     const int numLineX = argc > 5 ? atoi(argv[5]) : 0;
     const int numLineY = argc > 5 ? atoi(argv[6]) : 0;
+    const int numThread = argc > 7 ? atoi(argv[7]) : 1;
 
     const int NUM_SURF_PARAM = 10;
 
@@ -50,6 +52,7 @@ int main(int argc, char** argv) {
     param.numSlice = 0;
     param.numLineX = size_t(numLineX);
     param.numLineY = size_t(numLineY);
+    param.numThread = size_t(numThread);
     hrm::defineParameters(robot, env3D, param);
 
     std::cout << "Initial number of sweep lines: {" << param.numLineX << ", "
@@ -62,13 +65,21 @@ int main(int argc, char** argv) {
     req.start = env3D.getEndPoints().at(0);
     req.goal = env3D.getEndPoints().at(1);
 
+    // Records in common benchmark schema
+    hrm::BenchmarkRecorder recorder("BenchProbHRM3D");
+    recorder.setMetadata("map_type", mapType);
+    recorder.setMetadata("robot_type", robotType);
+    recorder.setMetadata("max_plan_time", MAX_PLAN_TIME);
+    recorder.setParameters(param);
+
     // Store results
     std::ofstream fileTimeStatistics;
     fileTimeStatistics.open(BENCHMARK_DATA_PATH "/time_prob_high_3D.csv");
     fileTimeStatistics << "SUCCESS" << ',' << "PLAN_TIME" << ',' << "N_LAYERS"
                        << ',' << "N_X" << ',' << "N_Y" << ',' << "GRAPH_NODE"
-                       << ',' << "GRAPH_EDGE" << ',' << "PATH_NODE"
-                       << "\n";
+                       << ',' << "GRAPH_EDGE" << ',' << "PATH_NODE";
+    hrm::storeStatisticsHeader(fileTimeStatistics);
+    fileTimeStatistics << "\n";
 
     // Benchmark
     std::cout << "Start benchmark..." << std::endl;
@@ -85,11 +96,13 @@ int main(int argc, char** argv) {
 
         const auto res = probHRM.getPlanningResult();
         const auto param = probHRM.getPlannerParameters();
+        recorder.addTrial("ProbHRM3D", hrm::getPlanningMetrics(res, param));
 
         // Store results
         hrm::displayPlanningTimeInfo(res.planningTime);
         hrm::displayGraphInfo(res.graphStructure);
         hrm::displayPathInfo(res.solutionPath);
+        hrm::displayOperationCountInfo(res.operationCount);
 
         std::cout << "Final number of C-slices: "
                   << probHRM.getPlannerParameters().numSlice << std::endl;
@@ -105,9 +118,14 @@ int main(int argc, char** argv) {
                            << param.numLineY << ','
                            << res.graphStructure.vertex.size() << ','
                            << res.graphStructure.edge.size() << ','
-                           << res.solutionPath.PathId.size() << "\n";
+                           << res.solutionPath.PathId.size();
+        hrm::storeStatistics(res.planningTime, res.operationCount,
+                             fileTimeStatistics);
+        fileTimeStatistics << "\n";
     }
     fileTimeStatistics.close();
 
+    recorder.store(BENCHMARK_DATA_PATH "/bench_prob_hrm_3D.json");
+
     return 0;
 }
@@ -2,6 +2,7 @@
 
 #include "hrm/config.h"
 #include "hrm/planners/HRM3DAblation.h"
+#include "hrm/test/util/BenchmarkRecorder.h"
 #include "hrm/test/util/DisplayPlanningData.h"
 #include "hrm/test/util/ParsePlanningSettings.h"
 
@@ -18,7 +19,9 @@ int main(int argc, char** argv) {
         std::cerr << "Usage: Please add 1) Map type 2) Robot type 3) Num of "
                      "trials 4) Max planning time (in seconds) 5) [optional] "
                      "Num of sweep lines (x-direction) 6) [optional] Num of "
-                     "sweep lines (y-direction)"
+                     "sweep lines (y-direction) 7) [optional] Continuous "
+                     "collision checking (0: interpolated poses, 1: "
+                     "continuous)"
                   << std::endl;
         return 1;
     }
@@ -30,7 +33,8 @@ int main(int argc, char** argv) {
     const auto MAX_PLAN_TIME = double(atoi(argv[4]));
 
     const int numLineX = argc > 5 ? atoi(argv[5]) : 0;
-    const int numLineY = argc > 5 ? atoi(argv[6]) : 0;
+    const int numLineY = argc > 6 ? atoi(argv[6]) : 0;
+    const bool isContinuousCollision = argc > 7 ? atoi(argv[7]) != 0 : false;
 
     const int NUM_SURF_PARAM = 10;
 
@@ -50,6 +54,7 @@ int main(int argc, char** argv) {
     param.numSlice = 0;
     param.numLineX = size_t(numLineX);
     param.numLineY = size_t(numLineY);
+    param.isContinuousCollision = isContinuousCollision;
     hrm::defineParameters(robot, env3D, param);
 
     std::cout << "Initial number of sweep lines: {" << param.numLineX << ", "
@@ -63,14 +68,22 @@ int main(int argc, char** argv) {
     req.start = env3D.getEndPoints().at(0);
     req.goal = env3D.getEndPoints().at(1);
 
+    // Records in common benchmark schema
+    hrm::BenchmarkRecorder recorder("BenchProbHRM3DAblation");
+    recorder.setMetadata("map_type", mapType);
+    recorder.setMetadata("robot_type", robotType);
+    recorder.setMetadata("max_plan_time", MAX_PLAN_TIME);
+    recorder.setParameters(param);
+
     // Store results
     std::ofstream fileTimeStatistics;
     fileTimeStatistics.open(BENCHMARK_DATA_PATH
                             "/time_prob_high_3D_ablation.csv");
     fileTimeStatistics << "SUCCESS" << ',' << "PLAN_TIME" << ',' << "N_LAYERS"
                        << ',' << "N_X" << ',' << "N_Y" << ',' << "GRAPH_NODE"
-                       << ',' << "GRAPH_EDGE" << ',' << "PATH_NODE"
-                       << "\n";
+                       << ',' << "GRAPH_EDGE" << ',' << "PATH_NODE";
+    hrm::storeStatisticsHeader(fileTimeStatistics);
+    fileTimeStatistics << "\n";
 
     // Benchmark
     std::cout << "Start benchmark..." << std::endl;
@@ -84,11 +97,15 @@ int main(int argc, char** argv) {
         prob_hrm_ablation.plan(MAX_PLAN_TIME);
 
         const auto res = prob_hrm_ablation.getPlanningResult();
+        recorder.addTrial("ProbHRM3DAblation",
+                          hrm::getPlanningMetrics(
+                              res, prob_hrm_ablation.getPlannerParameters()));
 
         // Store results
         hrm::displayPlanningTimeInfo(res.planningTime);
         hrm::displayGraphInfo(res.graphStructure);
         hrm::displayPathInfo(res.solutionPath);
+        hrm::displayOperationCountInfo(res.operationCount);
 
         std::cout << "Final number of C-slices: "
                   << prob_hrm_ablation.getPlannerParameters().numSlice
@@ -108,9 +125,14 @@ int main(int argc, char** argv) {
                            << prob_hrm_ablation.getPlannerParameters().numLineY
                            << ',' << res.graphStructure.vertex.size() << ','
                            << res.graphStructure.edge.size() << ','
-                           << res.solutionPath.PathId.size() << "\n";
+                           << res.solutionPath.PathId.size();
+        hrm::storeStatistics(res.planningTime, res.operationCount,
+                             fileTimeStatistics);
+        fileTimeStatistics << "\n";
     }
     fileTimeStatistics.close();
 
+    recorder.store(BENCHMARK_DATA_PATH "/bench_prob_hrm_3D_ablation.json");
+
     return 0;
 }
@@ -0,0 +1,60 @@
+/** \author Sipu Ruan */
+
+#include "hrm/config.h"
+#include "hrm/test/util/SceneGenerator.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv) {
+    if (argc >= 4) {
+        std::cout << "Procedural scene generator for scaling benchmarks"
+                  << std::endl;
+        std::cout << "----------" << std::endl;
+    } else {
+        std::cerr << "Usage: Please add 1) Dimension (2D or 3D) 2) Scene name "
+                     "3) Num of obstacles 4) [optional] Num of passages 5) "
+                     "[optional] Passage width 6) [optional] Random seed 7) "
+                     "[optional] Scale of arena size"
+                  << std::endl;
+        return 1;
+    }
+
+    const std::string dim = argv[1];
+    const std::string sceneName = argv[2];
+
+    hrm::SceneParameter param;
+    param.numObstacle = size_t(atoi(argv[3]));
+    param.numPassage = argc > 4 ? size_t(atoi(argv[4])) : 0;
+    param.passageWidth = argc > 5 ? atof(argv[5]) : param.passageWidth;
+    param.seed = argc > 6 ? unsigned(atoi(argv[6])) : param.seed;
+
+    const double arenaScale = argc > 7 ? atof(argv[7]) : 1.0;
+    for (auto& semiAxis : param.arenaSemiAxis) {
+        semiAxis *= arenaScale;
+    }
+
+    // Generated scenes are stored with the fixed ones, so that the scene
+    // name can be used as map type by demos and benchmarks
+    const std::string mapType = "generated_" + sceneName;
+    hrm::SceneDescription scene;
+    if (dim == "2D") {
+        scene = hrm::generateScene2D(param);
+        hrm::storeScene(scene, "superellipse", mapType, dim,
+                        RESOURCES_PATH "/2D");
+    } else if (dim == "3D") {
+        scene = hrm::generateScene3D(param);
+        hrm::storeScene(scene, "superquadrics", mapType, dim,
+                        RESOURCES_PATH "/3D");
+    } else {
+        std::cerr << "Only '2D' and '3D' are supported." << std::endl;
+        return 1;
+    }
+
+    std::cout << "Number of obstacles (including walls): "
+              << scene.obstacle.size() << std::endl;
+    std::cout << "Map type: [" << mapType << "]" << std::endl;
+
+    return 0;
+}